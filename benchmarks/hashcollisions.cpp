@@ -0,0 +1,183 @@
+//
+//  hashcollisions.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Collision counts of hydra::Hash against the hash combination it replaced
+
+#include "../include/hydra.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <unordered_set>
+#include <vector>
+
+using namespace hydra;
+
+namespace {
+
+// The combination the std::hash specializations used before hydra::Hash.
+// Each float hashes to its bit pattern, as std::hash<float> does in libc++;
+// libstdc++ hashes the bytes, which hides the clustering on that library only.
+size_t _legacyHash(const float* c, int count)
+{
+  size_t h = 0;
+  for (int i = 0; i < count; i++) {
+    uint32_t bits;
+    memcpy(&bits, &c[i], sizeof(bits));
+    h ^= (size_t)bits << i;
+  }
+  return h;
+}
+
+size_t _legacyHash(const AABB& b)
+{
+  return _legacyHash(b.min.c, 3) ^ (_legacyHash(b.max.c, 3) << 1);
+}
+
+size_t _legacyHash(const Quaternion& q)
+{
+  return _legacyHash(q.c, 4);
+}
+
+template<typename T>
+size_t _legacyHash(const T& v)
+{
+  return _legacyHash(v.c, (int)(sizeof(v.c) / sizeof(float)));
+}
+
+// Keys that share a full hash value, keys that share a bucket of a power of
+// two table with one bucket per key, and the longest bucket
+struct Collisions
+{
+  size_t full;
+  size_t bucket;
+  size_t longest;
+};
+
+Collisions _count(const std::vector<size_t>& hashes)
+{
+  size_t buckets = 1;
+  while (buckets < hashes.size()) {
+    buckets <<= 1;
+  }
+  std::unordered_set<size_t> distinct(hashes.begin(), hashes.end());
+  std::vector<size_t> sizes(buckets, 0);
+  Collisions c;
+  c.full = hashes.size() - distinct.size();
+  c.bucket = 0;
+  c.longest = 0;
+  for (size_t i = 0; i < hashes.size(); i++) {
+    size_t& size = sizes[hashes[i] & (buckets - 1)];
+    if (size > 0) {
+      c.bucket++;
+    }
+    size++;
+    c.longest = size > c.longest ? size : c.longest;
+  }
+  return c;
+}
+
+// Prints both hashes of keys and returns the number of full collisions of
+// hydra::Hash
+template<typename T>
+size_t _report(const char* name, const std::vector<T>& keys)
+{
+  std::vector<size_t> legacy;
+  std::vector<size_t> mixed;
+  for (size_t i = 0; i < keys.size(); i++) {
+    legacy.push_back(_legacyHash(keys[i]));
+    mixed.push_back(std::hash<T>()(keys[i]));
+  }
+  Collisions l = _count(legacy);
+  Collisions h = _count(mixed);
+  printf("%-24s %6zu keys  legacy: %6zu full %6zu bucket %5zu longest  hydra: %6zu full %6zu bucket %5zu longest\n",
+         name, keys.size(), l.full, l.bucket, l.longest, h.full, h.bucket, h.longest);
+  return h.full;
+}
+
+} // anonymous namespace
+
+int main()
+{
+  size_t failures = 0;
+
+  std::vector<Vector2> vector2Grid;
+  for (int y = 0; y < 64; y++) {
+    for (int x = 0; x < 64; x++) {
+      vector2Grid.push_back(Vector2::Create((float)x, (float)y));
+    }
+  }
+  failures += _report("Vector2 grid", vector2Grid);
+
+  std::vector<Vector3> vector3Grid;
+  std::vector<Vector3> vector3HalfGrid;
+  std::vector<AABB> aabbCells;
+  for (int z = 0; z < 16; z++) {
+    for (int y = 0; y < 16; y++) {
+      for (int x = 0; x < 16; x++) {
+        Vector3 v = Vector3::Create((float)x, (float)y, (float)z);
+        vector3Grid.push_back(v);
+        vector3HalfGrid.push_back(v * 0.5f);
+        aabbCells.push_back(AABB::Create(v, v + Vector3::One()));
+      }
+    }
+  }
+  failures += _report("Vector3 grid", vector3Grid);
+  failures += _report("Vector3 half-unit grid", vector3HalfGrid);
+  failures += _report("AABB unit cells", aabbCells);
+
+  std::vector<Vector4> vector4Grid;
+  std::vector<Quaternion> quaternionGrid;
+  for (int w = 0; w < 8; w++) {
+    for (int z = 0; z < 8; z++) {
+      for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 8; x++) {
+          vector4Grid.push_back(Vector4::Create((float)x, (float)y, (float)z, (float)w));
+          quaternionGrid.push_back(Quaternion::Create((float)w, (float)x, (float)y, (float)z));
+        }
+      }
+    }
+  }
+  failures += _report("Vector4 grid", vector4Grid);
+  failures += _report("Quaternion grid", quaternionGrid);
+
+  // A pair the legacy combination maps together: the bits of 1.0f shifted
+  // left by one equal those of 4.0f shifted by one xor 1.0f shifted by two
+  Vector3 a = Vector3::Create(0.0f, 1.0f, 0.0f);
+  Vector3 b = Vector3::Create(0.0f, 4.0f, 1.0f);
+  bool legacyPair = _legacyHash(a) == _legacyHash(b);
+  bool hydraPair = std::hash<Vector3>()(a) == std::hash<Vector3>()(b);
+  printf("(0,1,0) vs (0,4,1)        legacy: %s  hydra: %s\n", legacyPair ? "collide" : "distinct", hydraPair ? "collide" : "distinct");
+  if (hydraPair) {
+    failures++;
+  }
+
+  return failures == 0 ? 0 : 1;
+}
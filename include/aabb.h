@@ -51,40 +51,102 @@ public:
   void init(const Vector3& minPoint, const Vector3& maxPoint);
   void init(const Vector3& corner1, const Vector3& corner2, const Matrix4& modelMatrix);
   void init();
-  static AABB Create(const Vector3& minPoint, const Vector3& maxPoint);
+  static constexpr AABB Create(const Vector3& minPoint, const Vector3& maxPoint);
   static AABB Create(const Vector3& corner1, const Vector3& corner2, const Matrix4& modelMatrix);
-  static AABB Create();
+  static constexpr AABB Create();
 
   void scale(const Vector3& s);
   void scale(float s);
 
-  Vector3 center() const;
-  Vector3 size() const;
-  float volume() const;
-  bool intersects(const AABB& b) const;
-  bool contains(const AABB& b) const;
-  bool contains(const Vector3& v) const;
+  constexpr Vector3 center() const;
+  constexpr Vector3 size() const;
+  constexpr float volume() const;
+  constexpr bool intersects(const AABB& b) const;
+  constexpr bool contains(const AABB& b) const;
+  constexpr bool contains(const Vector3& v) const;
 
   bool intersectsLine(const Vector3& v1, const Vector3& v2) const;
   bool intersectsRay(const Vector3& v1, const Vector3& dir) const;
   bool intersectsSphere(const Vector3& center, float radius) const;
   void encapsulate(const AABB& b);
 
-  bool operator ==(const AABB& b) const;
-  bool operator !=(const AABB& b) const;
+  constexpr bool operator ==(const AABB& b) const;
+  constexpr bool operator !=(const AABB& b) const;
 
   // Comparison operators are implemented to allow insertion into sorted containers such as std::set
   bool operator >(const AABB& b) const;
   bool operator <(const AABB& b) const;
 
-  static AABB Infinite();
-  static AABB Zero();
+  static constexpr AABB Infinite();
+  static constexpr AABB Zero();
 
   float longest_radius() const;
   Vector3 nearestPoint(const Vector3& v) const;
 };
 static_assert(std::is_pod<AABB>::value, "hydra::AABB must be a POD type.");
 
+constexpr AABB AABB::Create()
+{
+  return AABB{ Vector3::Min(), Vector3::Max() };
+}
+
+constexpr AABB AABB::Create(const Vector3& minPoint, const Vector3& maxPoint)
+{
+  return AABB{ minPoint, maxPoint };
+}
+
+constexpr bool AABB::operator ==(const AABB& b) const
+{
+  return min == b.min && max == b.max;
+}
+
+constexpr bool AABB::operator !=(const AABB& b) const
+{
+  return min != b.min || max != b.max;
+}
+
+constexpr Vector3 AABB::center() const
+{
+  return (min + max) * 0.5f;
+}
+
+constexpr Vector3 AABB::size() const
+{
+  return max - min;
+}
+
+constexpr float AABB::volume() const
+{
+  return (max.x - min.x) * (max.y - min.y) * (max.z - min.z);
+}
+
+constexpr bool AABB::intersects(const AABB& b) const
+{
+  // Return true if the two volumes intersect
+  return min.x <= b.max.x && min.y <= b.max.y && min.z <= b.max.z && max.x >= b.min.x && max.y >= b.min.y && max.z >= b.min.z;
+}
+
+constexpr bool AABB::contains(const AABB& b) const
+{
+  // Return true if the passed KRAABB is entirely contained within this KRAABB
+  return b.min.x >= min.x && b.min.y >= min.y && b.min.z >= min.z && b.max.x <= max.x && b.max.y <= max.y && b.max.z <= max.z;
+}
+
+constexpr bool AABB::contains(const Vector3& v) const
+{
+  return v.x >= min.x && v.x <= max.x && v.y >= min.y && v.y <= max.y && v.z >= min.z && v.z <= max.z;
+}
+
+constexpr AABB AABB::Infinite()
+{
+  return AABB::Create(Vector3::Min(), Vector3::Max());
+}
+
+constexpr AABB AABB::Zero()
+{
+  return AABB::Create(Vector3::Zero(), Vector3::Zero());
+}
+
 } // namespace hydra
 
 namespace std {
@@ -94,9 +156,8 @@ struct hash<hydra::AABB>
 public:
   size_t operator()(const hydra::AABB& s) const
   {
-    size_t h1 = hash<hydra::Vector3>()(s.min);
-    size_t h2 = hash<hydra::Vector3>()(s.max);
-    return h1 ^ (h2 << 1);
+    uint64_t h = hydra::Hash::Floats(s.min.c, 3, 0);
+    return (size_t)hydra::Hash::Floats(s.max.c, 3, h);
   }
 };
 } // namespace std
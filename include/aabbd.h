@@ -0,0 +1,174 @@
+//
+//  aabbd.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Double precision axis aligned bounding box, for world space bounds that
+// exceed the useful range of a float
+
+#pragma once
+
+#include <functional> // for hash<>
+
+#include "aabb.h"
+#include "vector3d.h"
+
+namespace hydra {
+
+class Matrix4d;
+
+class AABBd
+{
+public:
+  Vector3d min;
+  Vector3d max;
+
+  void init(const Vector3d& minPoint, const Vector3d& maxPoint);
+  void init(const Vector3d& corner1, const Vector3d& corner2, const Matrix4d& modelMatrix);
+  void init(const AABB& b);
+  void init();
+  static constexpr AABBd Create(const Vector3d& minPoint, const Vector3d& maxPoint);
+  static AABBd Create(const Vector3d& corner1, const Vector3d& corner2, const Matrix4d& modelMatrix);
+  static constexpr AABBd Create(const AABB& b);
+  static constexpr AABBd Create();
+
+  // Converts to single precision, losing precision for large coordinates
+  constexpr AABB asAABB() const;
+  // Converts to single precision, relative to origin
+  constexpr AABB asAABB(const Vector3d& origin) const;
+
+  constexpr Vector3d center() const;
+  constexpr Vector3d size() const;
+  constexpr double volume() const;
+  constexpr bool intersects(const AABBd& b) const;
+  constexpr bool contains(const AABBd& b) const;
+  constexpr bool contains(const Vector3d& v) const;
+
+  void encapsulate(const AABBd& b);
+  Vector3d nearestPoint(const Vector3d& v) const;
+
+  constexpr bool operator ==(const AABBd& b) const;
+  constexpr bool operator !=(const AABBd& b) const;
+
+  static constexpr AABBd Infinite();
+  static constexpr AABBd Zero();
+};
+static_assert(std::is_pod<AABBd>::value, "hydra::AABBd must be a POD type.");
+
+constexpr AABBd AABBd::Create(const Vector3d& minPoint, const Vector3d& maxPoint)
+{
+  return AABBd{ minPoint, maxPoint };
+}
+
+constexpr AABBd AABBd::Create(const AABB& b)
+{
+  return AABBd{ Vector3d::Create(b.min), Vector3d::Create(b.max) };
+}
+
+constexpr AABBd AABBd::Create()
+{
+  return AABBd{ Vector3d::Min(), Vector3d::Max() };
+}
+
+constexpr AABB AABBd::asAABB() const
+{
+  return AABB::Create(min.asVector3(), max.asVector3());
+}
+
+constexpr AABB AABBd::asAABB(const Vector3d& origin) const
+{
+  return AABB::Create(min.asVector3(origin), max.asVector3(origin));
+}
+
+constexpr Vector3d AABBd::center() const
+{
+  return (min + max) * 0.5;
+}
+
+constexpr Vector3d AABBd::size() const
+{
+  return max - min;
+}
+
+constexpr double AABBd::volume() const
+{
+  return (max.x - min.x) * (max.y - min.y) * (max.z - min.z);
+}
+
+constexpr bool AABBd::intersects(const AABBd& b) const
+{
+  // Return true if the two volumes intersect
+  return min.x <= b.max.x && min.y <= b.max.y && min.z <= b.max.z && max.x >= b.min.x && max.y >= b.min.y && max.z >= b.min.z;
+}
+
+constexpr bool AABBd::contains(const AABBd& b) const
+{
+  // Return true if the passed AABBd is entirely contained within this AABBd
+  return b.min.x >= min.x && b.min.y >= min.y && b.min.z >= min.z && b.max.x <= max.x && b.max.y <= max.y && b.max.z <= max.z;
+}
+
+constexpr bool AABBd::contains(const Vector3d& v) const
+{
+  return v.x >= min.x && v.x <= max.x && v.y >= min.y && v.y <= max.y && v.z >= min.z && v.z <= max.z;
+}
+
+constexpr bool AABBd::operator ==(const AABBd& b) const
+{
+  return min == b.min && max == b.max;
+}
+
+constexpr bool AABBd::operator !=(const AABBd& b) const
+{
+  return min != b.min || max != b.max;
+}
+
+constexpr AABBd AABBd::Infinite()
+{
+  return AABBd::Create(Vector3d::Min(), Vector3d::Max());
+}
+
+constexpr AABBd AABBd::Zero()
+{
+  return AABBd::Create(Vector3d::Zero(), Vector3d::Zero());
+}
+
+} // namespace hydra
+
+namespace std {
+template<>
+struct hash<hydra::AABBd>
+{
+public:
+  size_t operator()(const hydra::AABBd& s) const
+  {
+    uint64_t h = hydra::Hash::Doubles(s.min.c, 3, 0);
+    return (size_t)hydra::Hash::Doubles(s.max.c, 3, h);
+  }
+};
+} // namespace std
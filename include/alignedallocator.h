@@ -0,0 +1,94 @@
+//
+//  alignedallocator.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Heap allocation with a minimum alignment, and a standard allocator for
+// containers of over-aligned types such as Vector3A and Matrix4A
+
+#pragma once
+
+#include <stddef.h>
+#include <new> // for bad_alloc
+
+namespace hydra {
+
+// alignment must be a power of two.  Memory from AlignedAlloc must be
+// released with AlignedFree.
+void* AlignedAlloc(size_t size, size_t alignment);
+void AlignedFree(void* p);
+
+// Allocates storage aligned to alignof(T).  Before C++17, std::allocator
+// only guarantees the alignment of the largest fundamental type, which is
+// not enough for the 32 byte aligned Matrix4A.
+template<typename T>
+class AlignedAllocator
+{
+public:
+  typedef T value_type;
+
+  AlignedAllocator()
+  {
+
+  }
+
+  template<typename U>
+  AlignedAllocator(const AlignedAllocator<U>&)
+  {
+
+  }
+
+  T* allocate(size_t n)
+  {
+    void* p = AlignedAlloc(n * sizeof(T), alignof(T));
+    if (p == nullptr) {
+      throw std::bad_alloc();
+    }
+    return (T*)p;
+  }
+
+  void deallocate(T* p, size_t)
+  {
+    AlignedFree(p);
+  }
+};
+
+template<typename T, typename U>
+bool operator ==(const AlignedAllocator<T>&, const AlignedAllocator<U>&)
+{
+  return true;
+}
+
+template<typename T, typename U>
+bool operator !=(const AlignedAllocator<T>&, const AlignedAllocator<U>&)
+{
+  return false;
+}
+
+} // namespace hydra
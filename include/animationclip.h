@@ -0,0 +1,108 @@
+//
+//  animationclip.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Compressed keyframe animation
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "vector3.h"
+#include "vector3s.h"
+#include "quaternion.h"
+#include "packedquaternion.h"
+
+namespace hydra {
+
+class Arena;
+
+// The keys of a track are stored contiguously in the clip, starting at
+// firstKey.  Vector3 keys are quantized relative to the range of the track:
+// a key decodes to center + k * extent, where k is the key as a Vector3s.
+class AnimationTrack
+{
+public:
+  uint32_t firstKey;
+  uint32_t keyCount;
+  Vector3 center;
+  Vector3 extent;
+};
+static_assert(std::is_pod<AnimationTrack>::value, "hydra::AnimationTrack must be a POD type.");
+
+// A set of Vector3 and Quaternion tracks, sampled together.  Vector3 tracks
+// are interpolated linearly and Quaternion tracks with normalized linear
+// interpolation.  Before sampling time t is clamped to the keys of each track.
+class AnimationClip
+{
+public:
+  AnimationClip();
+  ~AnimationClip();
+
+  // Adds a track from count keys, with strictly increasing times.  Keys that
+  // interpolation of the retained keys reproduces within tolerance are
+  // discarded; for Vector3 tracks tolerance is a distance, for Quaternion
+  // tracks it is the Euclidean distance between unit quaternions, about half
+  // the rotation error in radians.  Quantization adds up to 1/65534 of the
+  // range of each Vector3 component, and about 1e-4 to each quaternion, on
+  // top of tolerance.  Returns the index of the track among the tracks of its
+  // type.
+  int addTrack(const float* times, const Vector3* values, size_t count, float tolerance);
+  int addTrack(const float* times, const Quaternion* values, size_t count, float tolerance);
+  // As above, taking the key reduction's working memory from scratch rather
+  // than the heap
+  int addTrack(const float* times, const Vector3* values, size_t count, float tolerance, Arena& scratch);
+  int addTrack(const float* times, const Quaternion* values, size_t count, float tolerance, Arena& scratch);
+  void clear();
+
+  int vector3TrackCount() const;
+  int quaternionTrackCount() const;
+  size_t keyCount() const; // Retained keys, over all tracks
+  float duration() const; // Time of the last key of any track
+
+  Vector3 sampleVector3(int track, float t) const;
+  Quaternion sampleQuaternion(int track, float t) const;
+
+  // Evaluates every track at time t, writing vector3TrackCount() values to
+  // vectors and quaternionTrackCount() values to rotations
+  void sample(float t, Vector3* vectors, Quaternion* rotations) const;
+
+private:
+  std::vector<AnimationTrack> m_vector3Tracks;
+  std::vector<AnimationTrack> m_quaternionTracks;
+  std::vector<float> m_vector3Times;
+  std::vector<float> m_quaternionTimes;
+  std::vector<Vector3s> m_vector3Keys;
+  std::vector<PackedQuaternion48> m_quaternionKeys;
+  float m_duration;
+};
+
+} // namespace hydra
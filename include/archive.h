@@ -0,0 +1,165 @@
+//
+//  archive.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Binary container for arrays of Hydra types, loadable by memory mapping
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "vector3.h"
+#include "matrix4.h"
+#include "aabb.h"
+#include "triangle3.h"
+
+namespace hydra {
+
+enum class ArchiveType : uint32_t
+{
+  BYTES,
+  UINT32,
+  VECTOR3,
+  MATRIX4,
+  AABB,
+  TRIANGLE3,
+  BVH // Blob written by BVH::write()
+};
+
+class ArchiveHeader
+{
+public:
+  char magic[4]; // "HYDA"
+  uint32_t endianTag;
+  uint32_t version;
+  uint32_t chunkCount;
+  uint64_t size; // Of the whole archive, in bytes
+  uint64_t checksum; // Hash::Bytes of the header, with this field zeroed, and everything following it
+  uint64_t reserved[4];
+};
+static_assert(std::is_pod<ArchiveHeader>::value, "hydra::ArchiveHeader must be a POD type.");
+static_assert(sizeof(ArchiveHeader) == 64, "hydra::ArchiveHeader must be 64 bytes.");
+
+class ArchiveChunk
+{
+public:
+  uint32_t id; // Application defined
+  ArchiveType type;
+  uint32_t elementSize;
+  uint32_t reserved;
+  uint64_t offset; // From the start of the archive
+  uint64_t count; // Elements
+};
+static_assert(std::is_pod<ArchiveChunk>::value, "hydra::ArchiveChunk must be a POD type.");
+static_assert(sizeof(ArchiveChunk) == 32, "hydra::ArchiveChunk must be 32 bytes.");
+
+// Archives are laid out as an ArchiveHeader, followed by an ArchiveChunk for
+// each chunk, followed by the chunk data.  Each chunk starts on an ALIGNMENT
+// byte boundary.  Data is stored in the byte order of the machine that wrote
+// it; the endian tag lets readers reject foreign archives.
+//
+// Archive is a read-only view of an archive.  Opening a file maps it into
+// memory, and the arrays returned by get() point directly into the mapping,
+// so they are only valid until the archive is closed.  Nothing is parsed or
+// copied beyond validating the header and chunk table.
+class Archive
+{
+public:
+  static const uint32_t VERSION = 2;
+  static const uint32_t ENDIAN_TAG = 0x01020304;
+  static const size_t ALIGNMENT = 64;
+
+  Archive();
+  ~Archive();
+
+  Archive(const Archive&) = delete;
+  Archive& operator=(const Archive&) = delete;
+
+  bool open(const char* path);
+  // Views an archive already in memory.  data must stay valid until the
+  // archive is closed and must be aligned to at least 8 bytes.
+  bool open(const void* data, size_t size);
+  void close();
+  bool isOpen() const;
+
+  // Recomputes the checksum over the whole archive.  This touches every page,
+  // so is not done by open().
+  bool verify() const;
+
+  const ArchiveHeader& getHeader() const;
+  size_t chunkCount() const;
+  const ArchiveChunk& getChunk(size_t index) const;
+  const ArchiveChunk* findChunk(uint32_t id) const;
+
+  // Returns false if there is no chunk with the id, or if it holds a
+  // different type
+  bool get(uint32_t id, const void*& data, size_t& length) const;
+  bool get(uint32_t id, const uint32_t*& data, size_t& count) const;
+  bool get(uint32_t id, const Vector3*& data, size_t& count) const;
+  bool get(uint32_t id, const Matrix4*& data, size_t& count) const;
+  bool get(uint32_t id, const AABB*& data, size_t& count) const;
+  bool get(uint32_t id, const Triangle3*& data, size_t& count) const;
+  bool get(uint32_t id, ArchiveType type, size_t elementSize, const void*& data, size_t& count) const;
+
+private:
+  const uint8_t* m_data;
+  size_t m_size;
+  void* m_mapping;
+  size_t m_mappingSize;
+};
+
+// Collects chunks and writes them out as an archive.  The data is copied
+// when each chunk is added.
+class ArchiveWriter
+{
+public:
+  ArchiveWriter();
+  ~ArchiveWriter();
+
+  void add(uint32_t id, const void* data, size_t length);
+  void add(uint32_t id, const uint32_t* data, size_t count);
+  void add(uint32_t id, const Vector3* data, size_t count);
+  void add(uint32_t id, const Matrix4* data, size_t count);
+  void add(uint32_t id, const AABB* data, size_t count);
+  void add(uint32_t id, const Triangle3* data, size_t count);
+  void add(uint32_t id, ArchiveType type, const void* data, size_t elementSize, size_t count);
+  void clear();
+
+  size_t size() const; // Of the archive, in bytes
+  void write(std::vector<uint8_t>& archive) const;
+  bool write(const char* path) const;
+
+private:
+  std::vector<ArchiveChunk> m_chunks;
+  std::vector<uint8_t> m_data; // Chunk data, with offsets relative to the start of m_data
+};
+
+} // namespace hydra
@@ -0,0 +1,147 @@
+//
+//  arena.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Bump allocator for per-frame and per-query scratch memory
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace hydra {
+
+// Hands out memory by advancing an offset through a list of blocks, so that
+// an allocation costs a few instructions and individual allocations are never
+// freed.  reset() makes all of the memory available again at once, typically
+// at the end of each frame or query; blocks are kept, so an arena that has
+// reached its working size stops calling malloc.  release() returns the
+// blocks to the heap.  Not thread safe; use one arena per thread.
+class Arena
+{
+public:
+  static const size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+  Arena();
+  Arena(size_t blockSize);
+  ~Arena();
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  // alignment must be a power of two.  Allocations larger than the block
+  // size get a block of their own.  Like operator new, throws
+  // std::bad_alloc if the heap is exhausted.
+  void* allocate(size_t size, size_t alignment);
+
+  // Uninitialized storage for count objects of type T
+  template<typename T>
+  T* allocate(size_t count)
+  {
+    return (T*)allocate(sizeof(T) * count, alignof(T));
+  }
+
+  // Invalidates every allocation made since the last reset, keeping the blocks
+  void reset();
+  // Invalidates every allocation and frees the blocks
+  void release();
+
+  size_t used() const; // Bytes allocated since the last reset, including alignment padding
+  size_t capacity() const; // Bytes held in blocks
+
+private:
+  struct Block
+  {
+    uint8_t* data;
+    size_t size;
+  };
+
+  std::vector<Block> m_blocks;
+  size_t m_blockSize;
+  size_t m_block; // Index of the block being allocated from
+  size_t m_offset; // Offset of the next free byte in the current block
+  size_t m_used; // Bytes used in the blocks before the current block
+};
+
+// Standard allocator drawing from an Arena, for containers of scratch data
+// that live no longer than the next reset().  deallocate() does nothing;
+// memory released by a growing container is only reclaimed by reset().
+template<typename T>
+class ArenaAllocator
+{
+public:
+  typedef T value_type;
+
+  ArenaAllocator(Arena& arena)
+    : m_arena(&arena)
+  {
+
+  }
+
+  template<typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other)
+    : m_arena(other.arena())
+  {
+
+  }
+
+  T* allocate(size_t n)
+  {
+    return m_arena->allocate<T>(n);
+  }
+
+  void deallocate(T*, size_t)
+  {
+
+  }
+
+  Arena* arena() const
+  {
+    return m_arena;
+  }
+
+private:
+  Arena* m_arena;
+};
+
+template<typename T, typename U>
+bool operator ==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{
+  return a.arena() == b.arena();
+}
+
+template<typename T, typename U>
+bool operator !=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{
+  return a.arena() != b.arena();
+}
+
+} // namespace hydra
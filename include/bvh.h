@@ -0,0 +1,176 @@
+//
+//  bvh.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Bounding volume hierarchy (BVH) over a triangle soup
+
+#pragma once
+
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+#include "aabb.h"
+#include "plane.h"
+#include "triangle3.h"
+#include "hitinfo.h"
+#include "raypacket.h"
+
+namespace hydra {
+
+class IndexedMesh;
+class Arena;
+class Archive;
+class ArchiveWriter;
+class Scheduler;
+
+// Nodes are stored depth-first in a flat array.  The left child of an interior
+// node immediately follows it; offset holds the index of the right child.
+// For leaves, offset is the index of the first triangle and count is non-zero.
+class BVHNode
+{
+public:
+  AABB bounds;
+  uint32_t offset;
+  uint16_t count;
+  uint16_t axis;
+
+  bool isLeaf() const;
+};
+static_assert(std::is_pod<BVHNode>::value, "hydra::BVHNode must be a POD type.");
+
+class BVH
+{
+public:
+  BVH();
+  BVH(const BVH& other);
+  ~BVH();
+
+  BVH& operator=(const BVH& other);
+
+  // Builds the hierarchy using a binned surface area heuristic.  The triangles
+  // are copied; hits report the index of the triangle in the source array as
+  // their primitive id.
+  void build(const Triangle3* triangles, size_t count);
+  void build(const IndexedMesh& mesh); // Uses the mesh's cached bounds and normals
+  // As above, taking temporary build data from scratch rather than the heap.
+  // The arena is not reset.
+  void build(const Triangle3* triangles, size_t count, Arena& scratch);
+  void build(const IndexedMesh& mesh, Arena& scratch);
+  void clear();
+
+  size_t nodeCount() const;
+  size_t triangleCount() const;
+  AABB bounds() const;
+
+  // dir need not be normalized; hit distances are measured in units of dir
+  bool rayCast(const Vector3& start, const Vector3& dir, HitInfo& hit) const;
+
+  // Traverses the hierarchy once for the whole packet, writing one HitInfo per
+  // ray.  Inactive rays and rays that miss receive a HitInfo for which
+  // didHit() returns false.
+  void rayCast(const RayPacket& packet, HitInfo* hits) const;
+
+  // Casts an arbitrary number of rays, MAX_RAYS at a time.  Coherent rays
+  // should be adjacent in the input to get the most benefit from packets.
+  void rayCast(const Vector3* starts, const Vector3* dirs, size_t count, HitInfo* hits) const;
+  void rayCast(const Vector3* starts, const Vector3* dirs, size_t count, HitInfo* hits, Scheduler& scheduler) const;
+
+  // Swept volume casts for character controllers and similar.  dir must be
+  // normalized.  The earliest contact within maxDistance is returned; the hit
+  // position is the contact point on the mesh and the normal points from the
+  // contact point towards the axis of the swept volume.  A volume that already
+  // overlaps the mesh reports a hit at distance zero.
+  bool sphereCast(const Vector3& start, const Vector3& dir, float radius, float maxDistance, HitInfo& hit) const;
+  bool capsuleCast(const Vector3& start1, const Vector3& start2, const Vector3& dir, float radius, float maxDistance, HitInfo& hit) const;
+
+  // Finds the point on the mesh closest to p.  The hit position is the closest
+  // point, the normal is the normal of the triangle containing it and the
+  // distance is the unsigned distance from p.  Nodes farther than the best
+  // distance found so far, or farther than maxDistance, are not visited.
+  bool closestPoint(const Vector3& p, HitInfo& hit) const;
+  bool closestPoint(const Vector3& p, float maxDistance, HitInfo& hit) const;
+
+  // Inside test for closed meshes, by majority vote of the crossing parity of
+  // three rays
+  bool containsPoint(const Vector3& p) const;
+
+  // Mesh-vs-mesh intersection, traversing both hierarchies together.  Both
+  // meshes must be in the same space.  Pairs hold the source index of the
+  // triangle in this mesh first and the triangle in other second.
+  bool intersects(const BVH& other) const;
+  void intersectingTriangles(const BVH& other, std::vector<std::pair<uint32_t, uint32_t> >& pairs) const;
+
+  // Finds pairs of triangles within the mesh that intersect, with the lower
+  // source index first.  Triangles sharing a vertex are considered adjacent
+  // and are not tested against each other.
+  void selfIntersectingTriangles(std::vector<std::pair<uint32_t, uint32_t> >& pairs) const;
+
+  // The hierarchy serializes to a single relocatable blob: a versioned header
+  // followed by the node, triangle, index and plane arrays, each aligned to 64
+  // bytes and linked only by offsets.  view() queries a blob in place, such
+  // as a chunk of a memory mapped Archive, without building or copying
+  // anything; the blob must stay valid and unmodified while it is viewed.
+  // view() checks only the header and the array bounds, so blobs from
+  // untrusted sources should be passed to Verify() first, which also checks
+  // the checksum and that every node links only to nodes and triangles within
+  // the blob.
+  void serialize(std::vector<uint8_t>& blob) const;
+  void write(ArchiveWriter& archive, uint32_t id) const;
+  bool view(const void* blob, size_t size);
+  bool view(const Archive& archive, uint32_t id);
+  bool isView() const;
+  static bool Verify(const void* blob, size_t size);
+
+private:
+  // Queries read the hierarchy through these pointers, which point either
+  // into the storage vectors below or into a serialized blob
+  const BVHNode* m_nodes;
+  const Triangle3* m_triangles; // Reordered so that each leaf is contiguous
+  const uint32_t* m_triangleIndices; // Index in the source array of each triangle
+  const Plane* m_planes; // Per triangle, with unit normals
+  size_t m_nodeCount;
+  size_t m_triangleCount;
+  bool m_view;
+
+  std::vector<BVHNode> m_nodeStorage;
+  std::vector<Triangle3> m_triangleStorage;
+  std::vector<uint32_t> m_triangleIndexStorage;
+  std::vector<Plane> m_planeStorage;
+
+  void attachStorage();
+
+  void rayCast(const RayPacket& packet, float* distance, float* u, float* v, uint32_t* triangle) const;
+  uint32_t countCrossings(const Vector3& start, const Vector3& dir) const;
+  bool sweep(const Vector3& start1, const Vector3& start2, const Vector3& dir, float radius, float maxDistance, HitInfo& hit) const;
+  bool overlap(const BVH& other, bool self, bool firstOnly, std::vector<std::pair<uint32_t, uint32_t> >* pairs) const;
+};
+
+} // namespace hydra
@@ -0,0 +1,86 @@
+//
+//  distancefield.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Signed distance field (SDF) sampled on a regular grid
+
+#pragma once
+
+#include <vector>
+
+#include "aabb.h"
+#include "vector3i.h"
+
+namespace hydra {
+
+class BVH;
+class Scheduler;
+
+class DistanceField
+{
+public:
+  DistanceField();
+  ~DistanceField();
+
+  // Samples the signed distance to the mesh at the center of each cell of a
+  // grid covering bounds.  The mesh must be closed; distances are negative
+  // inside.  Where the closest point lies inside a face, the sign comes from
+  // the side of that face, so every triangle must be wound with its normal,
+  // Cross(v1 - v0, v2 - v0), pointing out of the mesh; faces wound the other
+  // way produce flipped signs near them.  Near edges and vertices the sign
+  // comes from BVH::containsPoint, which does not depend on winding.  A
+  // threadCount of zero uses one thread per hardware thread.
+  void bake(const BVH& mesh, const AABB& bounds, const Vector3i& resolution, unsigned int threadCount);
+  void bake(const BVH& mesh, const AABB& bounds, const Vector3i& resolution, Scheduler& scheduler);
+  void clear();
+
+  AABB getBounds() const;
+  Vector3i getResolution() const;
+  Vector3 getCellSize() const;
+  Vector3 cellCenter(const Vector3i& cell) const;
+
+  float getValue(const Vector3i& cell) const;
+  const float* getValues() const; // x varies fastest, then y, then z
+
+  // Trilinear interpolation between cell centers.  Points outside the grid
+  // are clamped to it.
+  float sample(const Vector3& p) const;
+  Vector3 gradient(const Vector3& p) const;
+
+private:
+  AABB m_bounds;
+  Vector3i m_resolution;
+  Vector3 m_cellSize;
+  std::vector<float> m_values;
+
+  size_t cellIndex(int x, int y, int z) const;
+};
+
+} // namespace hydra
@@ -0,0 +1,157 @@
+//
+//  flatcache.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Fixed-capacity open-addressing cache
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h> // for memcmp
+#include <type_traits>
+#include <vector>
+
+#include "hash.h"
+
+namespace hydra {
+
+// Maps POD keys to values in a single flat allocation made at construction.
+// Keys are compared and hashed by their bytes, so -0.0 and 0.0 are distinct
+// keys, and key types must not contain padding.
+//
+// Each key may live in one of PROBE_LIMIT consecutive slots starting at its
+// hash.  When all of them are taken, the least recently used entry among
+// them is replaced, which approximates LRU eviction without any per-entry
+// links.  Not thread safe.
+template<class Key, class Value>
+class FlatCache
+{
+public:
+  static const size_t PROBE_LIMIT = 8;
+
+  // capacity is rounded up to a power of two of at least PROBE_LIMIT
+  FlatCache(size_t capacity)
+  {
+    static_assert(std::is_pod<Key>::value, "hydra::FlatCache keys must be POD types.");
+    size_t slots = PROBE_LIMIT;
+    while (slots < capacity) {
+      slots *= 2;
+    }
+    m_entries.resize(slots);
+    clear();
+  }
+
+  ~FlatCache()
+  {
+
+  }
+
+  void clear()
+  {
+    for (size_t i = 0; i < m_entries.size(); i++) {
+      m_entries[i].lastUse = 0;
+    }
+    m_clock = 0;
+    m_size = 0;
+  }
+
+  size_t capacity() const
+  {
+    return m_entries.size();
+  }
+
+  size_t size() const
+  {
+    return m_size;
+  }
+
+  // Returns the cached value and marks it as recently used, or nullptr
+  const Value* find(const Key& key)
+  {
+    size_t mask = m_entries.size() - 1;
+    size_t slot = hashKey(key) & mask;
+    for (size_t i = 0; i < PROBE_LIMIT; i++, slot = (slot + 1) & mask) {
+      Entry& entry = m_entries[slot];
+      if (entry.lastUse == 0) {
+        return nullptr; // Slots are never emptied individually, so the key is not further along
+      }
+      if (memcmp(&entry.key, &key, sizeof(Key)) == 0) {
+        entry.lastUse = ++m_clock;
+        return &entry.value;
+      }
+    }
+    return nullptr;
+  }
+
+  // Inserts or replaces the value for key, evicting if needed
+  void insert(const Key& key, const Value& value)
+  {
+    size_t mask = m_entries.size() - 1;
+    size_t slot = hashKey(key) & mask;
+    Entry* target = nullptr;
+    for (size_t i = 0; i < PROBE_LIMIT; i++, slot = (slot + 1) & mask) {
+      Entry& entry = m_entries[slot];
+      if (entry.lastUse == 0) {
+        target = &entry;
+        m_size++;
+        break;
+      }
+      if (memcmp(&entry.key, &key, sizeof(Key)) == 0) {
+        target = &entry;
+        break;
+      }
+      if (target == nullptr || entry.lastUse < target->lastUse) {
+        target = &entry;
+      }
+    }
+    target->key = key;
+    target->value = value;
+    target->lastUse = ++m_clock;
+  }
+
+private:
+  struct Entry
+  {
+    Key key;
+    Value value;
+    uint64_t lastUse; // Zero for an empty slot
+  };
+
+  std::vector<Entry> m_entries;
+  uint64_t m_clock;
+  size_t m_size;
+
+  static size_t hashKey(const Key& key)
+  {
+    return (size_t)Hash::Bytes(&key, sizeof(Key), 0);
+  }
+};
+
+} // namespace hydra
@@ -0,0 +1,161 @@
+//
+//  gjk.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Gilbert-Johnson-Keerthi (GJK) distance and intersection queries, and the
+// Expanding Polytope Algorithm (EPA) for penetration depth, between convex
+// shapes described by their support functions.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "aabb.h"
+#include "matrix4.h"
+#include "triangle3.h"
+
+namespace hydra {
+
+class ConvexShape
+{
+public:
+  virtual ~ConvexShape();
+
+  // Returns the point of the shape that is farthest in direction dir.  dir
+  // is not necessarily normalized and may be zero.
+  virtual Vector3 support(const Vector3& dir) const = 0;
+};
+
+// Convex hull of a point set.  The points are referenced, not copied, and are
+// transformed by the model matrix.
+class ConvexHull : public ConvexShape
+{
+public:
+  ConvexHull(const Vector3* points, size_t count);
+  ConvexHull(const Vector3* points, size_t count, const Matrix4& modelMatrix);
+  virtual Vector3 support(const Vector3& dir) const;
+
+private:
+  const Vector3* m_points;
+  size_t m_count;
+  Matrix4 m_modelMatrix;
+};
+
+class ConvexBox : public ConvexShape
+{
+public:
+  ConvexBox(const AABB& box);
+  ConvexBox(const AABB& box, const Matrix4& modelMatrix);
+  virtual Vector3 support(const Vector3& dir) const;
+
+private:
+  AABB m_box;
+  Matrix4 m_modelMatrix;
+};
+
+class ConvexSphere : public ConvexShape
+{
+public:
+  ConvexSphere(const Vector3& center, float radius);
+  virtual Vector3 support(const Vector3& dir) const;
+
+private:
+  Vector3 m_center;
+  float m_radius;
+};
+
+class ConvexCapsule : public ConvexShape
+{
+public:
+  ConvexCapsule(const Vector3& point1, const Vector3& point2, float radius);
+  virtual Vector3 support(const Vector3& dir) const;
+
+private:
+  Vector3 m_point1;
+  Vector3 m_point2;
+  float m_radius;
+};
+
+class ConvexTriangle : public ConvexShape
+{
+public:
+  ConvexTriangle(const Triangle3& triangle);
+  virtual Vector3 support(const Vector3& dir) const;
+
+private:
+  Triangle3 m_triangle;
+};
+
+// The search directions of the final simplex of a query.  Keep one per pair
+// of shapes and pass it back on the next frame; when the shapes have moved
+// only a little, the query then converges within a few iterations.
+class GJKSimplex
+{
+public:
+  Vector3 dir[4];
+  int count;
+
+  void init();
+  static GJKSimplex Create();
+};
+static_assert(std::is_pod<GJKSimplex>::value, "hydra::GJKSimplex must be a POD type.");
+
+class GJKResult
+{
+public:
+  Vector3 pointA; // Closest (or deepest) point on shape A
+  Vector3 pointB; // Closest (or deepest) point on shape B
+  Vector3 normal; // Unit vector pointing from shape A towards shape B
+  float distance; // Separating distance, or penetration depth for EPA
+  int iterations;
+};
+static_assert(std::is_pod<GJKResult>::value, "hydra::GJKResult must be a POD type.");
+
+class GJK
+{
+public:
+  // Returns true if the shapes overlap, or if no separating axis was found
+  // within the iteration limit
+  static bool Intersect(const ConvexShape& a, const ConvexShape& b, GJKSimplex& simplex);
+
+  // Returns true and fills in result if the shapes are separated.  Returns
+  // false if the shapes overlap, or if the query did not converge within the
+  // iteration limit.
+  static bool Distance(const ConvexShape& a, const ConvexShape& b, GJKSimplex& simplex, GJKResult& result);
+
+  // Runs GJK and then EPA on overlapping shapes.  Returns true and fills in the
+  // penetration depth, the contact normal and the deepest points if the shapes
+  // overlap.  Translating B by normal * distance separates the shapes.  If
+  // GJK runs out of iterations without finding a separating axis, the shapes
+  // are reported as touching at the closest points found.
+  static bool Penetration(const ConvexShape& a, const ConvexShape& b, GJKSimplex& simplex, GJKResult& result);
+};
+
+} // namespace hydra
@@ -0,0 +1,158 @@
+//
+//  hash.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Hashing for Hydra types
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h> // for memcpy
+
+namespace hydra {
+
+// 64-bit hashing in the style of wyhash: input is consumed 8 bytes at a time
+// and folded into the state with a 64x64->128 bit multiply, whose high and
+// low halves are xored together.  Every input bit affects every output bit,
+// so small integer and grid-aligned coordinates spread evenly over a table.
+//
+// Floats are canonicalized before hashing, so that -0.0 hashes like 0.0 and
+// every NaN hashes alike, consistent with the == operators of the vector
+// types for zeros.
+class Hash
+{
+public:
+  static const uint64_t P0 = 0xa0761d6478bd642full;
+  static const uint64_t P1 = 0xe7037ed1a0b428dbull;
+  static const uint64_t P2 = 0x8ebc6af09c88c6e3ull;
+  static const uint64_t P3 = 0x589965cc75374cc3ull;
+
+  static uint64_t Mix(uint64_t a, uint64_t b)
+  {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 r = (unsigned __int128)a * b;
+    return (uint64_t)r ^ (uint64_t)(r >> 64);
+#else
+    uint64_t ha = a >> 32, la = (uint32_t)a;
+    uint64_t hb = b >> 32, lb = (uint32_t)b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32);
+    uint64_t c = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    return lo ^ hi;
+#endif
+  }
+
+  static uint32_t CanonicalBits(float v)
+  {
+    if (v == 0.0f) {
+      return 0; // -0.0 and 0.0
+    }
+    if (v != v) {
+      return 0x7fc00000; // Quiet NaN
+    }
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    return bits;
+  }
+
+  static uint64_t CanonicalBits(double v)
+  {
+    if (v == 0.0) {
+      return 0; // -0.0 and 0.0
+    }
+    if (v != v) {
+      return 0x7ff8000000000000ull; // Quiet NaN
+    }
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    return bits;
+  }
+
+  static uint64_t Floats(const float* v, size_t count, uint64_t seed)
+  {
+    uint64_t h = seed ^ P0;
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+      uint64_t word = (uint64_t)CanonicalBits(v[i]) | ((uint64_t)CanonicalBits(v[i + 1]) << 32);
+      h = Mix(word ^ P1, h ^ P2);
+    }
+    if (i < count) {
+      h = Mix((uint64_t)CanonicalBits(v[i]) ^ P1, h ^ P3);
+    }
+    return Mix(h ^ P0, (uint64_t)count ^ P1);
+  }
+
+  static uint64_t Doubles(const double* v, size_t count, uint64_t seed)
+  {
+    uint64_t h = seed ^ P0;
+    for (size_t i = 0; i < count; i++) {
+      h = Mix(CanonicalBits(v[i]) ^ P1, h ^ P2);
+    }
+    return Mix(h ^ P0, (uint64_t)count ^ P1);
+  }
+
+  static uint64_t Ints(const int* v, size_t count, uint64_t seed)
+  {
+    uint64_t h = seed ^ P0;
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+      uint64_t word = (uint64_t)(uint32_t)v[i] | ((uint64_t)(uint32_t)v[i + 1] << 32);
+      h = Mix(word ^ P1, h ^ P2);
+    }
+    if (i < count) {
+      h = Mix((uint64_t)(uint32_t)v[i] ^ P1, h ^ P3);
+    }
+    return Mix(h ^ P0, (uint64_t)count ^ P1);
+  }
+
+  // Hashes raw bytes, for POD types without floating point members
+  static uint64_t Bytes(const void* data, size_t length, uint64_t seed)
+  {
+    const uint8_t* p = (const uint8_t*)data;
+    uint64_t h = seed ^ P0;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+      uint64_t word;
+      memcpy(&word, p + i, 8);
+      h = Mix(word ^ P1, h ^ P2);
+    }
+    if (i < length) {
+      uint64_t word = 0;
+      memcpy(&word, p + i, length - i);
+      h = Mix(word ^ P1, h ^ P3);
+    }
+    return Mix(h ^ P0, (uint64_t)length ^ P1);
+  }
+};
+
+} // namespace hydra
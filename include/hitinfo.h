@@ -31,34 +31,44 @@
 
 #pragma once
 
-#include "vector3.h"
+#include <stdint.h>
 
-class KRNode;
+#include "vector2.h"
+#include "vector3.h"
 
 namespace hydra {
 
 class HitInfo
 {
 public:
-  HitInfo();
-  HitInfo(const Vector3& position, const Vector3& normal, const float distance);
-  HitInfo(const Vector3& position, const Vector3& normal, const float distance, KRNode* node);
-  ~HitInfo();
+  static const uint32_t INVALID_ID = 0xffffffff;
+
+  void init();
+  void init(const Vector3& position, const Vector3& normal, const float distance);
+  void init(const Vector3& position, const Vector3& normal, const float distance, const Vector2& barycentric, uint32_t primitiveId, uint32_t instanceId);
+  static HitInfo Create();
+  static HitInfo Create(const Vector3& position, const Vector3& normal, const float distance);
+  static HitInfo Create(const Vector3& position, const Vector3& normal, const float distance, const Vector2& barycentric, uint32_t primitiveId, uint32_t instanceId);
 
   Vector3 getPosition() const;
   Vector3 getNormal() const;
   float getDistance() const;
-  KRNode* getNode() const;
+  Vector2 getBarycentric() const; // Weights of the second and third triangle vertices at the hit point
+  uint32_t getPrimitiveId() const;
+  uint32_t getInstanceId() const;
   bool didHit() const;
 
-  HitInfo& operator =(const HitInfo& b);
+  void setInstanceId(uint32_t instanceId);
 
 private:
-  KRNode* m_node;
   Vector3 m_position;
   Vector3 m_normal;
+  Vector2 m_barycentric;
   float m_distance;
+  uint32_t m_primitiveId;
+  uint32_t m_instanceId;
+  uint32_t m_hit;
 };
+static_assert(std::is_pod<HitInfo>::value, "hydra::HitInfo must be a POD type.");
 
 } // namespace hydra
-
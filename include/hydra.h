@@ -31,16 +31,45 @@
 
 #pragma once
 
+#include "hash.h"
 #include "scalar.h"
+#include "profile.h"
 #include "vector2.h"
 #include "vector3.h"
 #include "vector4.h"
 #include "vector2i.h"
 #include "vector3i.h"
+#include "vector3d.h"
+#include "vector3h.h"
+#include "vector3s.h"
+#include "vector3a.h"
+#include "octahedralnormal.h"
 #include "matrix2.h"
 #include "matrix2x3.h"
 #include "matrix4.h"
+#include "matrix4d.h"
+#include "matrix4a.h"
 #include "quaternion.h"
+#include "quaterniond.h"
+#include "packedquaternion.h"
+#include "alignedallocator.h"
+#include "arena.h"
+#include "threadpool.h"
+#include "flatcache.h"
+#include "matrixinversecache.h"
 #include "aabb.h"
+#include "aabbd.h"
+#include "plane.h"
+#include "obb.h"
+#include "sphere.h"
 #include "triangle3.h"
+#include "vertexwelder.h"
+#include "indexedmesh.h"
+#include "animationclip.h"
 #include "hitinfo.h"
+#include "raypacket.h"
+#include "bvh.h"
+#include "distancefield.h"
+#include "gjk.h"
+#include "voxelizer.h"
+#include "archive.h"
@@ -0,0 +1,101 @@
+//
+//  indexedmesh.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Indexed triangle mesh
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "aabb.h"
+#include "triangle3.h"
+
+namespace hydra {
+
+class Arena;
+
+// Vertices are shared between triangles through an index buffer holding
+// three indices per triangle.  Per-triangle edges, normals and bounds are
+// computed on first use and cached until the geometry changes.  The caches
+// are filled by const accessors, so a mesh that is shared between threads
+// should have updateCaches() called on it first.
+class IndexedMesh
+{
+public:
+  IndexedMesh();
+  ~IndexedMesh();
+
+  void set(const Vector3* vertices, size_t vertexCount, const uint32_t* indices, size_t indexCount);
+  void clear();
+
+  size_t vertexCount() const;
+  size_t triangleCount() const;
+  const Vector3* getVertices() const;
+  const uint32_t* getIndices() const;
+  const Vector3& getVertex(size_t index) const;
+  void setVertex(size_t index, const Vector3& v);
+
+  // Merges vertices within epsilon of each other using VertexWelder and
+  // remaps the indices.  Triangles that become degenerate are kept.
+  void weld(float epsilon);
+  // As above, taking the welder's spatial hash from scratch rather than the
+  // heap
+  void weld(float epsilon, Arena& scratch);
+
+  // Triangle3 views for the existing triangle-based APIs
+  Triangle3 getTriangle(size_t triangle) const;
+  void getTriangles(std::vector<Triangle3>& triangles) const;
+
+  // Edges are vert[1] - vert[0] and vert[2] - vert[0]
+  const Vector3& getEdge1(size_t triangle) const;
+  const Vector3& getEdge2(size_t triangle) const;
+
+  // Unit normal, following the winding as in Triangle3::calculateNormal.
+  // Degenerate triangles have a zero normal.
+  const Vector3& getNormal(size_t triangle) const;
+  const AABB& getTriangleBounds(size_t triangle) const;
+  AABB getBounds() const;
+
+  void updateCaches() const;
+
+private:
+  std::vector<Vector3> m_vertices;
+  std::vector<uint32_t> m_indices;
+
+  mutable bool m_cacheValid;
+  mutable std::vector<Vector3> m_edges; // Two per triangle
+  mutable std::vector<Vector3> m_normals;
+  mutable std::vector<AABB> m_triangleBounds;
+  mutable AABB m_bounds;
+};
+
+} // namespace hydra
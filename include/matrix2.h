@@ -99,9 +99,7 @@ struct hash<hydra::Matrix2>
 public:
   size_t operator()(const hydra::Matrix2& s) const
   {
-    size_t h1 = hash<hydra::Vector2>()(s.axis_x);
-    size_t h2 = hash<hydra::Vector2>()(s.axis_y);
-    return h1 ^ (h2 << 1);
+    return (size_t)hydra::Hash::Floats(s.c, 4, 0);
   }
 };
 } // namespace std
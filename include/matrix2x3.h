@@ -101,10 +101,7 @@ struct hash<hydra::Matrix2x3>
 public:
   size_t operator()(const hydra::Matrix2x3& s) const
   {
-    size_t h1 = hash<hydra::Vector2>()(s.axis_x);
-    size_t h2 = hash<hydra::Vector2>()(s.axis_y);
-    size_t h3 = hash<hydra::Vector2>()(s.transform);
-    return h1 ^ (h2 << 1) ^ (h3 << 2);
+    return (size_t)hydra::Hash::Floats(s.c, 6, 0);
   }
 };
 } // namespace std
@@ -68,20 +68,20 @@ public:
   void init(const Matrix4& m);
 
   static Matrix4 Create(float* pMat);
-  static Matrix4 Create(const Vector3& new_axis_x, const Vector3& new_axis_y, const Vector3& new_axis_z, const Vector3& new_transform);
+  static constexpr Matrix4 Create(const Vector3& new_axis_x, const Vector3& new_axis_y, const Vector3& new_axis_z, const Vector3& new_transform);
 
   // Overload comparison operator
   bool operator==(const Matrix4& m) const;
 
   // Overload compound multiply operator
-  Matrix4& operator*=(const Matrix4& m);
+  constexpr Matrix4& operator*=(const Matrix4& m);
 
   float& operator[](unsigned i);
   float operator[](unsigned i) const;
 
   // Overload multiply operator
   //Matrix4& operator*(const Matrix4 &m);
-  Matrix4 operator*(const Matrix4& m) const;
+  constexpr Matrix4 operator*(const Matrix4& m) const;
 
   float* getPointer();
 
@@ -101,20 +101,75 @@ public:
   static Vector3 DotNoTranslate(const Matrix4& m, const Vector3& v); // Dot product without including translation; useful for transforming normals and tangents
   static Matrix4 Invert(const Matrix4& m);
   static Matrix4 Transpose(const Matrix4& m);
-  static Vector3 Dot(const Matrix4& m, const Vector3& v);
+  static constexpr Vector3 Dot(const Matrix4& m, const Vector3& v);
   static Vector4 Dot4(const Matrix4& m, const Vector4& v);
   static float DotW(const Matrix4& m, const Vector3& v);
   static Vector3 DotWDiv(const Matrix4& m, const Vector3& v);
 
   static Matrix4 LookAt(const Vector3& cameraPos, const Vector3& lookAtPos, const Vector3& upDirection);
 
-  static Matrix4 Translation(const Vector3& v);
+  static constexpr Matrix4 Translation(const Vector3& v);
   static Matrix4 Rotation(const Vector3& v);
-  static Matrix4 Scaling(const Vector3& v);
-  static Matrix4 Identity();
+  static constexpr Matrix4 Scaling(const Vector3& v);
+  static constexpr Matrix4 Identity();
 };
 static_assert(std::is_pod<Matrix4>::value, "hydra::Matrix4 must be a POD type.");
 
+constexpr Matrix4 Matrix4::Create(const Vector3& new_axis_x, const Vector3& new_axis_y, const Vector3& new_axis_z, const Vector3& new_transform)
+{
+  return Matrix4{ { {
+    Vector4::Create(new_axis_x.x, new_axis_x.y, new_axis_x.z, 0.0f),
+    Vector4::Create(new_axis_y.x, new_axis_y.y, new_axis_y.z, 0.0f),
+    Vector4::Create(new_axis_z.x, new_axis_z.y, new_axis_z.z, 0.0f),
+    Vector4::Create(new_transform.x, new_transform.y, new_transform.z, 1.0f)
+  } } };
+}
+
+constexpr Matrix4 Matrix4::Translation(const Vector3& v)
+{
+  return Matrix4::Create(Vector3::Right(), Vector3::Up(), Vector3::Forward(), v);
+}
+
+constexpr Matrix4 Matrix4::Scaling(const Vector3& v)
+{
+  return Matrix4::Create(Vector3::Create(v.x, 0.0f, 0.0f),
+                         Vector3::Create(0.0f, v.y, 0.0f),
+                         Vector3::Create(0.0f, 0.0f, v.z),
+                         Vector3::Zero());
+}
+
+constexpr Matrix4 Matrix4::Identity()
+{
+  return Matrix4::Create(Vector3::Right(), Vector3::Up(), Vector3::Forward(), Vector3::Zero());
+}
+
+// Each row of the product is the rows of m weighted by the matching row of
+// this matrix
+constexpr Matrix4 Matrix4::operator*(const Matrix4& m) const
+{
+  return Matrix4{ { {
+    m.axis_x * axis_x.x + m.axis_y * axis_x.y + m.axis_z * axis_x.z + m.transform * axis_x.w,
+    m.axis_x * axis_y.x + m.axis_y * axis_y.y + m.axis_z * axis_y.z + m.transform * axis_y.w,
+    m.axis_x * axis_z.x + m.axis_y * axis_z.y + m.axis_z * axis_z.z + m.transform * axis_z.w,
+    m.axis_x * transform.x + m.axis_y * transform.y + m.axis_z * transform.z + m.transform * transform.w
+  } } };
+}
+
+constexpr Matrix4& Matrix4::operator*=(const Matrix4& m)
+{
+  *this = *this * m;
+  return *this;
+}
+
+constexpr Vector3 Matrix4::Dot(const Matrix4& m, const Vector3& v)
+{
+  return Vector3::Create(
+      v.x * m.axis_x.x + v.y * m.axis_y.x + v.z * m.axis_z.x + m.transform.x,
+      v.x * m.axis_x.y + v.y * m.axis_y.y + v.z * m.axis_z.y + m.transform.y,
+      v.x * m.axis_x.z + v.y * m.axis_y.z + v.z * m.axis_z.z + m.transform.z
+  );
+}
+
 } // namespace hydra
 
 namespace std {
@@ -124,11 +179,7 @@ struct hash<hydra::Matrix4>
 public:
   size_t operator()(const hydra::Matrix4& s) const
   {
-    size_t h1 = hash<hydra::Vector4>()(s.axis_x);
-    size_t h2 = hash<hydra::Vector4>()(s.axis_y);
-    size_t h3 = hash<hydra::Vector4>()(s.axis_z);
-    size_t h4 = hash<hydra::Vector4>()(s.transform);
-    return h1 ^ (h2 << 1) ^ (h3 << 2) ^ (h4 << 3);
+    return (size_t)hydra::Hash::Floats(s.c, 16, 0);
   }
 };
 } // namespace std
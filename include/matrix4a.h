@@ -0,0 +1,103 @@
+//
+//  matrix4a.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// 4x4 matrix aligned to 32 bytes, so that its columns can be loaded with
+// aligned SIMD loads.  Converts implicitly to Matrix4.
+
+#pragma once
+
+#include <functional> // for hash<>
+
+#include "matrix4.h"
+#include "vector3a.h"
+
+namespace hydra {
+
+class Scheduler;
+
+class alignas(32) Matrix4A
+{
+public:
+  // Matrix components, in column-major order
+  float c[16];
+
+  // Default initializer - Creates an identity matrix
+  void init();
+  void init(const Matrix4& m);
+
+  static Matrix4A Create(const Matrix4& m);
+
+  operator Matrix4() const;
+
+  // Overload comparison operator
+  bool operator==(const Matrix4A& m) const;
+
+  // Overload compound multiply operator
+  Matrix4A& operator*=(const Matrix4A& m);
+
+  // Overload multiply operator
+  Matrix4A operator*(const Matrix4A& m) const;
+
+  static Vector3A DotNoTranslate(const Matrix4A& m, const Vector3A& v); // Dot product without including translation; useful for transforming normals and tangents
+  static Matrix4A Invert(const Matrix4A& m);
+  static Matrix4A Transpose(const Matrix4A& m);
+  static Vector3A Dot(const Matrix4A& m, const Vector3A& v);
+  static void Dot(const Matrix4A& m, const Vector3A* v, Vector3A* out, size_t count);
+  static void Dot(const Matrix4A& m, const Vector3A* v, Vector3A* out, size_t count, Scheduler& scheduler);
+
+  static constexpr Matrix4A Identity();
+};
+static_assert(std::is_pod<Matrix4A>::value, "hydra::Matrix4A must be a POD type.");
+static_assert(sizeof(Matrix4A) == 64 && alignof(Matrix4A) == 32, "hydra::Matrix4A must be 64 bytes and 32 byte aligned.");
+
+constexpr Matrix4A Matrix4A::Identity()
+{
+  return Matrix4A{ {
+    1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f
+  } };
+}
+
+} // namespace hydra
+
+namespace std {
+template<>
+struct hash<hydra::Matrix4A>
+{
+public:
+  size_t operator()(const hydra::Matrix4A& s) const
+  {
+    return (size_t)hydra::Hash::Floats(s.c, 16, 0);
+  }
+};
+} // namespace std
@@ -0,0 +1,146 @@
+//
+//  matrix4d.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Double precision 4x4 matrix, for world space transforms that exceed the
+// useful range of a float
+
+#pragma once
+
+#include <functional> // for hash<>
+
+#include "matrix4.h"
+#include "vector3d.h"
+
+namespace hydra {
+
+class Quaterniond;
+class Scheduler;
+
+class Matrix4d
+{
+public:
+  // Matrix components, in column-major order
+  double c[16];
+
+  // Default initializer - Creates an identity matrix
+  void init();
+
+  void init(double* pMat);
+  void init(const Vector3d& new_axis_x, const Vector3d& new_axis_y, const Vector3d& new_axis_z, const Vector3d& new_transform);
+  void init(const Matrix4d& m);
+  void init(const Matrix4& m);
+
+  static Matrix4d Create(double* pMat);
+  static constexpr Matrix4d Create(const Vector3d& new_axis_x, const Vector3d& new_axis_y, const Vector3d& new_axis_z, const Vector3d& new_transform);
+  static Matrix4d Create(const Matrix4& m);
+
+  // Converts to single precision, losing precision for large translations
+  Matrix4 asMatrix4() const;
+  // Converts to single precision, with the translation made relative to origin
+  Matrix4 asMatrix4(const Vector3d& origin) const;
+
+  // Overload comparison operator
+  bool operator==(const Matrix4d& m) const;
+
+  // Overload compound multiply operator
+  Matrix4d& operator*=(const Matrix4d& m);
+
+  double& operator[](unsigned i);
+  double operator[](unsigned i) const;
+
+  // Overload multiply operator
+  Matrix4d operator*(const Matrix4d& m) const;
+
+  double* getPointer();
+
+  void translate(const Vector3d& v);
+  void scale(const Vector3d& v);
+  void rotate(const Quaternion& q);
+  void rotate(const Quaterniond& q);
+  bool invert();
+  void transpose();
+
+  static Vector3d DotNoTranslate(const Matrix4d& m, const Vector3d& v); // Dot product without including translation; useful for transforming normals and tangents
+  static Matrix4d Invert(const Matrix4d& m);
+  static Matrix4d Transpose(const Matrix4d& m);
+  static Vector3d Dot(const Matrix4d& m, const Vector3d& v);
+  static void Dot(const Matrix4d& m, const Vector3d* v, Vector3d* out, size_t count);
+  static void Dot(const Matrix4d& m, const Vector3d* v, Vector3d* out, size_t count, Scheduler& scheduler);
+  static double DotW(const Matrix4d& m, const Vector3d& v);
+  static Vector3d DotWDiv(const Matrix4d& m, const Vector3d& v);
+
+  static constexpr Matrix4d Translation(const Vector3d& v);
+  static constexpr Matrix4d Scaling(const Vector3d& v);
+  static constexpr Matrix4d Identity();
+};
+static_assert(std::is_pod<Matrix4d>::value, "hydra::Matrix4d must be a POD type.");
+
+constexpr Matrix4d Matrix4d::Create(const Vector3d& new_axis_x, const Vector3d& new_axis_y, const Vector3d& new_axis_z, const Vector3d& new_transform)
+{
+  return Matrix4d{ {
+    new_axis_x.x, new_axis_x.y, new_axis_x.z, 0.0,
+    new_axis_y.x, new_axis_y.y, new_axis_y.z, 0.0,
+    new_axis_z.x, new_axis_z.y, new_axis_z.z, 0.0,
+    new_transform.x, new_transform.y, new_transform.z, 1.0
+  } };
+}
+
+constexpr Matrix4d Matrix4d::Translation(const Vector3d& v)
+{
+  return Matrix4d::Create(Vector3d::Right(), Vector3d::Up(), Vector3d::Forward(), v);
+}
+
+constexpr Matrix4d Matrix4d::Scaling(const Vector3d& v)
+{
+  return Matrix4d::Create(Vector3d::Create(v.x, 0.0, 0.0),
+                          Vector3d::Create(0.0, v.y, 0.0),
+                          Vector3d::Create(0.0, 0.0, v.z),
+                          Vector3d::Zero());
+}
+
+constexpr Matrix4d Matrix4d::Identity()
+{
+  return Matrix4d::Create(Vector3d::Right(), Vector3d::Up(), Vector3d::Forward(), Vector3d::Zero());
+}
+
+} // namespace hydra
+
+namespace std {
+template<>
+struct hash<hydra::Matrix4d>
+{
+public:
+  size_t operator()(const hydra::Matrix4d& s) const
+  {
+    return (size_t)hydra::Hash::Doubles(s.c, 16, 0);
+  }
+};
+} // namespace std
@@ -0,0 +1,71 @@
+//
+//  matrixinversecache.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Memoized matrix inversion
+
+#pragma once
+
+#include "matrix4.h"
+#include "flatcache.h"
+
+namespace hydra {
+
+// Remembers recently inverted matrices, so that inverting the same camera or
+// bone matrix several times per frame costs a hash lookup after the first
+// time.  Matrices are matched bit for bit.  Not thread safe.
+class MatrixInverseCache
+{
+public:
+  MatrixInverseCache(size_t capacity);
+  ~MatrixInverseCache();
+
+  // Same result as Matrix4::invert: returns false, leaving inverse
+  // unchanged, when m is singular
+  bool invert(const Matrix4& m, Matrix4& inverse);
+  Matrix4 invert(const Matrix4& m); // Returns m unchanged when it is singular, as Matrix4::Invert does
+
+  void clear();
+  size_t hits() const;
+  size_t misses() const;
+
+private:
+  struct CachedInverse
+  {
+    Matrix4 inverse;
+    bool invertible;
+  };
+
+  FlatCache<Matrix4, CachedInverse> m_cache;
+  size_t m_hits;
+  size_t m_misses;
+};
+
+} // namespace hydra
@@ -0,0 +1,113 @@
+//
+//  obb.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Oriented bounding box (OBB)
+
+#pragma once
+
+#include <functional> // for hash<>
+
+#include "vector3.h"
+#include "aabb.h"
+
+namespace hydra {
+
+class Matrix4;
+class Quaternion;
+
+class OBB
+{
+public:
+  Vector3 center;
+  Vector3 halfExtents;
+  Vector3 axis[3]; // Orthonormal local axes; the columns of the rotation matrix
+
+  void init();
+  void init(const Vector3& center, const Vector3& halfExtents, const Quaternion& rotation);
+  void init(const Vector3& center, const Vector3& halfExtents, const Vector3& axisX, const Vector3& axisY, const Vector3& axisZ);
+  void init(const AABB& box);
+  void init(const AABB& box, const Matrix4& modelMatrix); // Unlike AABB::init with a model matrix, rotation does not inflate the box
+  static OBB Create();
+  static OBB Create(const Vector3& center, const Vector3& halfExtents, const Quaternion& rotation);
+  static OBB Create(const Vector3& center, const Vector3& halfExtents, const Vector3& axisX, const Vector3& axisY, const Vector3& axisZ);
+  static OBB Create(const AABB& box);
+  static OBB Create(const AABB& box, const Matrix4& modelMatrix);
+
+  Quaternion rotation() const;
+  Matrix4 modelMatrix() const; // Maps the unit cube [-1, 1] onto the box
+  AABB bounds() const;
+  float volume() const;
+  float surfaceArea() const;
+  void corners(Vector3* out) const; // Writes 8 corners
+
+  bool contains(const Vector3& p) const;
+  Vector3 nearestPoint(const Vector3& p) const;
+
+  // Separating axis tests
+  bool intersects(const OBB& b) const;
+  bool intersects(const AABB& b) const;
+
+  // dir need not be normalized; distance is measured in units of dir and is
+  // zero when the ray starts inside the box
+  bool intersectsRay(const Vector3& start, const Vector3& dir) const;
+  bool intersectsRay(const Vector3& start, const Vector3& dir, float& distance) const;
+
+  bool operator ==(const OBB& b) const;
+  bool operator !=(const OBB& b) const;
+
+  // Fits a box to a point set using principal component analysis of the
+  // points' covariance.  Fast, but sensitive to uneven point distributions.
+  static OBB FitPCA(const Vector3* points, size_t count);
+
+  // Fits a box using the ditetrahedron method (DiTO-14) of Larsson and
+  // Kallberg, which searches orientations derived from 14 extremal points.
+  // Usually tighter than PCA at a similar cost.
+  static OBB FitDiTO(const Vector3* points, size_t count);
+};
+static_assert(std::is_pod<OBB>::value, "hydra::OBB must be a POD type.");
+
+} // namespace hydra
+
+namespace std {
+template<>
+struct hash<hydra::OBB>
+{
+public:
+  size_t operator()(const hydra::OBB& s) const
+  {
+    uint64_t h = hydra::Hash::Floats(s.center.c, 3, 0);
+    h = hydra::Hash::Floats(s.halfExtents.c, 3, h);
+    h = hydra::Hash::Floats(s.axis[0].c, 3, h);
+    h = hydra::Hash::Floats(s.axis[1].c, 3, h);
+    return (size_t)hydra::Hash::Floats(s.axis[2].c, 3, h);
+  }
+};
+} // namespace std
@@ -0,0 +1,77 @@
+//
+//  octahedralnormal.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Storage-only unit vector in 32 bits.  The unit sphere is projected onto an
+// octahedron, which is unfolded into the [-1, 1] square and quantized to two
+// signed normalized 16-bit values.
+
+#pragma once
+
+#include <functional> // for hash<>
+#include <stdint.h>
+
+#include "vector3.h"
+
+namespace hydra {
+
+class OctahedralNormal
+{
+public:
+  int16_t x, y;
+
+  // n must be non-zero; it does not have to be normalized
+  void init(const Vector3& n);
+  static OctahedralNormal Create(const Vector3& n);
+
+  // Returns a normalized vector
+  Vector3 asVector3() const;
+
+  bool operator ==(const OctahedralNormal& b) const;
+  bool operator !=(const OctahedralNormal& b) const;
+
+  static void Pack(const Vector3* n, OctahedralNormal* out, size_t count);
+  static void Unpack(const OctahedralNormal* n, Vector3* out, size_t count);
+};
+static_assert(std::is_pod<OctahedralNormal>::value, "hydra::OctahedralNormal must be a POD type.");
+
+} // namespace hydra
+
+namespace std {
+template<>
+struct hash<hydra::OctahedralNormal>
+{
+public:
+  size_t operator()(const hydra::OctahedralNormal& s) const
+  {
+    return (size_t)hydra::Hash::Bytes(&s, sizeof(s), 0);
+  }
+};
+} // namespace std
@@ -0,0 +1,109 @@
+//
+//  packedquaternion.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Storage-only unit quaternions using "smallest three" compression.  The
+// component with the largest magnitude is dropped, the sign of the
+// quaternion is flipped so that it is positive, and the remaining three
+// components, which lie in [-1/sqrt(2), 1/sqrt(2)], are quantized.  The
+// dropped component is recovered from the unit length constraint.
+
+#pragma once
+
+#include <functional> // for hash<>
+#include <stdint.h>
+
+#include "quaternion.h"
+
+namespace hydra {
+
+// 2 bit index and 3 x 10 bit components
+class PackedQuaternion32
+{
+public:
+  uint32_t bits;
+
+  // q must be normalized
+  void init(const Quaternion& q);
+  static PackedQuaternion32 Create(const Quaternion& q);
+
+  Quaternion asQuaternion() const;
+
+  bool operator ==(const PackedQuaternion32& b) const;
+  bool operator !=(const PackedQuaternion32& b) const;
+
+  static void Pack(const Quaternion* q, PackedQuaternion32* out, size_t count);
+  static void Unpack(const PackedQuaternion32* q, Quaternion* out, size_t count);
+};
+static_assert(std::is_pod<PackedQuaternion32>::value, "hydra::PackedQuaternion32 must be a POD type.");
+
+// 2 bit index and 3 x 15 bit components, in three 16 bit words
+class PackedQuaternion48
+{
+public:
+  uint16_t c[3];
+
+  // q must be normalized
+  void init(const Quaternion& q);
+  static PackedQuaternion48 Create(const Quaternion& q);
+
+  Quaternion asQuaternion() const;
+
+  bool operator ==(const PackedQuaternion48& b) const;
+  bool operator !=(const PackedQuaternion48& b) const;
+
+  static void Pack(const Quaternion* q, PackedQuaternion48* out, size_t count);
+  static void Unpack(const PackedQuaternion48* q, Quaternion* out, size_t count);
+};
+static_assert(std::is_pod<PackedQuaternion48>::value, "hydra::PackedQuaternion48 must be a POD type.");
+
+} // namespace hydra
+
+namespace std {
+template<>
+struct hash<hydra::PackedQuaternion32>
+{
+public:
+  size_t operator()(const hydra::PackedQuaternion32& s) const
+  {
+    return (size_t)hydra::Hash::Bytes(&s, sizeof(s), 0);
+  }
+};
+
+template<>
+struct hash<hydra::PackedQuaternion48>
+{
+public:
+  size_t operator()(const hydra::PackedQuaternion48& s) const
+  {
+    return (size_t)hydra::Hash::Bytes(&s, sizeof(s), 0);
+  }
+};
+} // namespace std
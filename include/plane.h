@@ -0,0 +1,142 @@
+//
+//  plane.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Plane
+
+#pragma once
+
+#include <functional> // for hash<>
+
+#include "vector3.h"
+#include "vector4.h"
+
+namespace hydra {
+
+class Matrix4;
+class Triangle3;
+
+enum class PlaneSide
+{
+  BACK,
+  ON,
+  FRONT,
+  SPANNING // Only returned when classifying a set of points
+};
+
+// Points p on the plane satisfy Dot(normal, p) == d.  The layout matches a
+// Vector4 with the normal in xyz and d in w.
+class Plane
+{
+public:
+  Vector3 normal;
+  float d;
+
+  void init();
+  void init(const Vector3& normal, float d);
+  void init(const Vector3& normal, const Vector3& point);
+  void init(const Vector3& v1, const Vector3& v2, const Vector3& v3); // Normal follows the winding, as in Triangle3::calculateNormal
+  void init(const Triangle3& tri);
+  void init(const Vector4& v);
+  static Plane Create();
+  static Plane Create(const Vector3& normal, float d);
+  static Plane Create(const Vector3& normal, const Vector3& point);
+  static Plane Create(const Vector3& v1, const Vector3& v2, const Vector3& v3);
+  static Plane Create(const Triangle3& tri);
+  static Plane Create(const Vector4& v);
+
+  Vector4 asVector4() const;
+
+  void normalize(); // Rescales the plane equation so that normal has unit length
+  static Plane Normalize(const Plane& p);
+  void flip();
+
+  // Signed distance; positive in front of the plane.  Measured in units of
+  // the normal's length.
+  float distance(const Vector3& p) const;
+  PlaneSide classify(const Vector3& p, float epsilon) const;
+  Vector3 project(const Vector3& p) const;
+
+  // dir need not be normalized; distance is measured in units of dir.  Rays
+  // hit from either side.
+  bool intersectsRay(const Vector3& start, const Vector3& dir, float& distance) const;
+
+  // Transforms the plane by m, using the inverse-transpose of m so that
+  // non-uniform scale keeps the normal perpendicular.  The result is
+  // normalized.
+  void transform(const Matrix4& m);
+  static Plane Transform(const Plane& p, const Matrix4& m);
+  static void Transform(const Plane* planes, size_t count, const Matrix4& m, Plane* out); // Inverts m once for the batch
+
+  bool operator ==(const Plane& b) const;
+  bool operator !=(const Plane& b) const;
+
+  // Batch signed distance of count points, written to distances
+  static void Distances(const Plane& plane, const Vector3* points, size_t count, float* distances);
+
+  // Classifies count points, writing each side to sides unless it is
+  // nullptr.  Returns FRONT or BACK when no point lies on the other side, ON
+  // when every point is within epsilon of the plane, and otherwise SPANNING.
+  static PlaneSide Classify(const Plane& plane, const Vector3* points, size_t count, float epsilon, PlaneSide* sides);
+
+  // Sutherland-Hodgman clipping of a convex polygon, keeping the part in
+  // front of the plane.  out must hold count + 1 vertices.  Returns the
+  // number of vertices written, which is zero when the polygon is clipped
+  // away entirely.
+  static size_t ClipPolygon(const Plane& plane, const Vector3* polygon, size_t count, Vector3* out);
+
+  // Clips a convex polygon against several planes, such as a frustum.  out
+  // and scratch must each hold count + planeCount vertices.
+  static size_t ClipPolygon(const Plane* planes, int planeCount, const Vector3* polygon, size_t count, Vector3* out, Vector3* scratch);
+
+  // Splits a convex polygon into the parts in front of and behind the plane.
+  // front and back must each hold count + 1 vertices.
+  static void SplitPolygon(const Plane& plane, const Vector3* polygon, size_t count, Vector3* front, size_t& frontCount, Vector3* back, size_t& backCount);
+
+  // Clips a triangle, keeping the part in front of the plane as up to two
+  // triangles written to out.  Returns the number of triangles written.
+  static size_t ClipTriangle(const Plane& plane, const Triangle3& tri, Triangle3* out);
+};
+static_assert(std::is_pod<Plane>::value, "hydra::Plane must be a POD type.");
+
+} // namespace hydra
+
+namespace std {
+template<>
+struct hash<hydra::Plane>
+{
+public:
+  size_t operator()(const hydra::Plane& s) const
+  {
+    uint64_t h = hydra::Hash::Floats(s.normal.c, 3, 0);
+    return (size_t)hydra::Hash::Floats(&s.d, 1, h);
+  }
+};
+} // namespace std
@@ -0,0 +1,112 @@
+//
+//  profile.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Opt-in call counters and cycle accumulators for Hydra entry points
+
+#pragma once
+
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+namespace hydra {
+
+class ProfileCounter
+{
+public:
+  const char* name;
+  uint64_t calls;
+  uint64_t cycles; // Including the cycles of nested entry points
+};
+static_assert(std::is_pod<ProfileCounter>::value, "hydra::ProfileCounter must be a POD type.");
+
+// When the library is configured with -DHYDRA_PROFILE=ON, every public entry
+// point that does more than a few instructions of work opens a
+// HYDRA_PROFILE_SCOPE, which counts its calls and accumulates the cycles spent
+// in it.  Counters are kept per thread, so recording takes no locks; Report()
+// sums them over all threads, including threads that have exited.  Without
+// HYDRA_PROFILE the scopes compile to nothing and Report() returns no
+// counters.  Applications may open scopes of their own with the same macro.
+class Profile
+{
+public:
+  static const int MAX_SITES = 512;
+
+  static bool Enabled(); // True when the library was built with HYDRA_PROFILE
+
+  // Replaces counters with the counts since the last Reset(), one entry per
+  // called site, in order of decreasing cycles
+  static void Report(std::vector<ProfileCounter>& counters);
+  static void Reset();
+
+  // Time stamp counter where available, otherwise nanoseconds
+  static uint64_t Cycles();
+
+  // Used by HYDRA_PROFILE_SCOPE.  Sites with the same name share counters.
+  // Returns -1 once MAX_SITES sites are registered; such sites are not
+  // counted.
+  static int RegisterSite(const char* name);
+  static void Record(int site, uint64_t cycles);
+};
+
+#ifdef HYDRA_PROFILE
+
+class ProfileScope
+{
+public:
+  ProfileScope(int site)
+    : m_site(site)
+    , m_start(Profile::Cycles())
+  {
+
+  }
+
+  ~ProfileScope()
+  {
+    Profile::Record(m_site, Profile::Cycles() - m_start);
+  }
+
+private:
+  int m_site;
+  uint64_t m_start;
+};
+
+#define HYDRA_PROFILE_SCOPE(name) \
+  static const int _hydraProfileSite = ::hydra::Profile::RegisterSite(name); \
+  ::hydra::ProfileScope _hydraProfileScope(_hydraProfileSite)
+
+#else
+
+#define HYDRA_PROFILE_SCOPE(name)
+
+#endif
+
+} // namespace hydra
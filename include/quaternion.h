@@ -52,20 +52,20 @@ public:
   void init(const Quaternion& p);
   void init(const Vector3& euler);
   void init(const Vector3& from_vector, const Vector3& to_vector);
-  static Quaternion Create();
-  static Quaternion Create(float w, float x, float y, float z);
-  static Quaternion Create(const Quaternion& p);
+  static constexpr Quaternion Create();
+  static constexpr Quaternion Create(float w, float x, float y, float z);
+  static constexpr Quaternion Create(const Quaternion& p);
   static Quaternion Create(const Vector3& euler);
   static Quaternion Create(const Vector3& from_vector, const Vector3& to_vector);
 
-  Quaternion operator +(const Quaternion& v) const;
-  Quaternion operator -(const Quaternion& v) const;
-  Quaternion operator +() const;
-  Quaternion operator -() const;
+  constexpr Quaternion operator +(const Quaternion& v) const;
+  constexpr Quaternion operator -(const Quaternion& v) const;
+  constexpr Quaternion operator +() const;
+  constexpr Quaternion operator -() const;
 
-  Quaternion operator *(const Quaternion& v);
-  Quaternion operator *(float num) const;
-  Quaternion operator /(float num) const;
+  constexpr Quaternion operator *(const Quaternion& v) const;
+  constexpr Quaternion operator *(float num) const;
+  constexpr Quaternion operator /(float num) const;
 
   Quaternion& operator +=(const Quaternion& v);
   Quaternion& operator -=(const Quaternion& v);
@@ -87,7 +87,7 @@ public:
   static Quaternion Normalize(const Quaternion& v1);
 
   void conjugate();
-  static Quaternion Conjugate(const Quaternion& v1);
+  static constexpr Quaternion Conjugate(const Quaternion& v1);
 
   void invert();
   static Quaternion Invert(const Quaternion& v1);
@@ -96,10 +96,87 @@ public:
   static Quaternion FromRotationMatrix(const Matrix4& m);
   static Quaternion Lerp(const Quaternion& a, const Quaternion& b, float t);
   static Quaternion Slerp(const Quaternion& a, const Quaternion& b, float t);
-  static float Dot(const Quaternion& v1, const Quaternion& v2);
+  static constexpr float Dot(const Quaternion& v1, const Quaternion& v2);
 };
 static_assert(std::is_pod<Quaternion>::value, "hydra::Quaternion must be a POD type.");
 
+constexpr Quaternion Quaternion::Create()
+{
+  return Quaternion{ { { 1.0f, 0.0f, 0.0f, 0.0f } } };
+}
+
+constexpr Quaternion Quaternion::Create(float w, float x, float y, float z)
+{
+  return Quaternion{ { { w, x, y, z } } };
+}
+
+constexpr Quaternion Quaternion::Create(const Quaternion& p)
+{
+  return Quaternion{ { { p.w, p.x, p.y, p.z } } };
+}
+
+constexpr Quaternion Quaternion::operator *(const Quaternion& v) const
+{
+  float t0 = (z - y) * (v.y - v.z);
+  float t1 = (w + x) * (v.w + v.x);
+  float t2 = (w - x) * (v.y + v.z);
+  float t3 = (z + y) * (v.w - v.x);
+  float t4 = (z - x) * (v.x - v.y);
+  float t5 = (z + x) * (v.x + v.y);
+  float t6 = (w + y) * (v.w - v.z);
+  float t7 = (w - y) * (v.w + v.z);
+  float t8 = t5 + t6 + t7;
+  float t9 = (t4 + t8) / 2;
+
+  return Quaternion::Create(
+      t0 + t9 - t5,
+      t1 + t9 - t8,
+      t2 + t9 - t7,
+      t3 + t9 - t6
+  );
+}
+
+constexpr Quaternion Quaternion::operator *(float v) const
+{
+  return Quaternion::Create(w * v, x * v, y * v, z * v);
+}
+
+constexpr Quaternion Quaternion::operator /(float num) const
+{
+  float inv_num = 1.0f / num;
+  return Quaternion::Create(w * inv_num, x * inv_num, y * inv_num, z * inv_num);
+}
+
+constexpr Quaternion Quaternion::operator +(const Quaternion& v) const
+{
+  return Quaternion::Create(w + v.w, x + v.x, y + v.y, z + v.z);
+}
+
+constexpr Quaternion Quaternion::operator -(const Quaternion& v) const
+{
+  return Quaternion::Create(w - v.w, x - v.x, y - v.y, z - v.z);
+}
+
+constexpr Quaternion Quaternion::operator +() const
+{
+  return *this;
+}
+
+constexpr Quaternion Quaternion::operator -() const
+{
+  return Quaternion::Create(-w, -x, -y, -z);
+}
+
+constexpr Quaternion Quaternion::Conjugate(const Quaternion& v1)
+{
+  return Quaternion::Create(v1.w, -v1.x, -v1.y, -v1.z);
+}
+
+constexpr float Quaternion::Dot(const Quaternion& v1, const Quaternion& v2)
+{
+  return v1.w * v2.w + v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
+}
+
 } // namespace hydra
 
 namespace std {
@@ -109,11 +186,7 @@ struct hash<hydra::Quaternion>
 public:
   size_t operator()(const hydra::Quaternion& s) const
   {
-    size_t h1 = hash<float>()(s.c[0]);
-    size_t h2 = hash<float>()(s.c[1]);
-    size_t h3 = hash<float>()(s.c[2]);
-    size_t h4 = hash<float>()(s.c[3]);
-    return h1 ^ (h2 << 1) ^ (h3 << 2) ^ (h4 << 3);
+    return (size_t)hydra::Hash::Floats(s.c, 4, 0);
   }
 };
 } // namespace std
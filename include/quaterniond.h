@@ -0,0 +1,217 @@
+//
+//  quaterniond.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Double precision quaternion, for rotations composed into Matrix4d
+// transforms
+
+#pragma once
+
+#include <functional> // for hash<>
+
+#include "quaternion.h"
+#include "vector3d.h"
+
+namespace hydra {
+
+class Matrix4d;
+
+class Quaterniond
+{
+public:
+  union
+  {
+    struct
+    {
+      double w, x, y, z;
+    };
+    double c[4];
+  };
+
+  void init();
+  void init(double w, double x, double y, double z);
+  void init(const Quaterniond& p);
+  void init(const Quaternion& p);
+  static constexpr Quaterniond Create();
+  static constexpr Quaterniond Create(double w, double x, double y, double z);
+  static constexpr Quaterniond Create(const Quaterniond& p);
+  static constexpr Quaterniond Create(const Quaternion& p);
+
+  // Converts to single precision
+  constexpr Quaternion asQuaternion() const;
+
+  constexpr Quaterniond operator +(const Quaterniond& v) const;
+  constexpr Quaterniond operator -(const Quaterniond& v) const;
+  constexpr Quaterniond operator +() const;
+  constexpr Quaterniond operator -() const;
+
+  constexpr Quaterniond operator *(const Quaterniond& v) const;
+  constexpr Quaterniond operator *(double num) const;
+  constexpr Quaterniond operator /(double num) const;
+
+  Quaterniond& operator +=(const Quaterniond& v);
+  Quaterniond& operator -=(const Quaterniond& v);
+  Quaterniond& operator *=(const Quaterniond& v);
+  Quaterniond& operator *=(const double& v);
+  Quaterniond& operator /=(const double& v);
+
+  constexpr bool operator ==(const Quaterniond& b) const;
+  constexpr bool operator !=(const Quaterniond& b) const;
+  double& operator [](unsigned i);
+  double operator [](unsigned i) const;
+
+  Matrix4d rotationMatrix() const;
+
+  void normalize();
+  static Quaterniond Normalize(const Quaterniond& v1);
+
+  void conjugate();
+  static constexpr Quaterniond Conjugate(const Quaterniond& v1);
+
+  void invert();
+  static Quaterniond Invert(const Quaterniond& v1);
+
+  static Quaterniond FromAngleAxis(const Vector3d& axis, double angle);
+  static Quaterniond Lerp(const Quaterniond& a, const Quaterniond& b, double t);
+  static Quaterniond Slerp(const Quaterniond& a, const Quaterniond& b, double t);
+  static constexpr double Dot(const Quaterniond& v1, const Quaterniond& v2);
+};
+static_assert(std::is_pod<Quaterniond>::value, "hydra::Quaterniond must be a POD type.");
+
+constexpr Quaterniond Quaterniond::Create()
+{
+  return Quaterniond{ { { 1.0, 0.0, 0.0, 0.0 } } };
+}
+
+constexpr Quaterniond Quaterniond::Create(double w, double x, double y, double z)
+{
+  return Quaterniond{ { { w, x, y, z } } };
+}
+
+constexpr Quaterniond Quaterniond::Create(const Quaterniond& p)
+{
+  return Quaterniond{ { { p.w, p.x, p.y, p.z } } };
+}
+
+constexpr Quaterniond Quaterniond::Create(const Quaternion& p)
+{
+  return Quaterniond{ { { (double)p.w, (double)p.x, (double)p.y, (double)p.z } } };
+}
+
+constexpr Quaternion Quaterniond::asQuaternion() const
+{
+  return Quaternion::Create((float)w, (float)x, (float)y, (float)z);
+}
+
+constexpr Quaterniond Quaterniond::operator *(const Quaterniond& v) const
+{
+  double t0 = (z - y) * (v.y - v.z);
+  double t1 = (w + x) * (v.w + v.x);
+  double t2 = (w - x) * (v.y + v.z);
+  double t3 = (z + y) * (v.w - v.x);
+  double t4 = (z - x) * (v.x - v.y);
+  double t5 = (z + x) * (v.x + v.y);
+  double t6 = (w + y) * (v.w - v.z);
+  double t7 = (w - y) * (v.w + v.z);
+  double t8 = t5 + t6 + t7;
+  double t9 = (t4 + t8) / 2;
+
+  return Quaterniond::Create(
+      t0 + t9 - t5,
+      t1 + t9 - t8,
+      t2 + t9 - t7,
+      t3 + t9 - t6
+  );
+}
+
+constexpr Quaterniond Quaterniond::operator *(double v) const
+{
+  return Quaterniond::Create(w * v, x * v, y * v, z * v);
+}
+
+constexpr Quaterniond Quaterniond::operator /(double num) const
+{
+  double inv_num = 1.0 / num;
+  return Quaterniond::Create(w * inv_num, x * inv_num, y * inv_num, z * inv_num);
+}
+
+constexpr Quaterniond Quaterniond::operator +(const Quaterniond& v) const
+{
+  return Quaterniond::Create(w + v.w, x + v.x, y + v.y, z + v.z);
+}
+
+constexpr Quaterniond Quaterniond::operator -(const Quaterniond& v) const
+{
+  return Quaterniond::Create(w - v.w, x - v.x, y - v.y, z - v.z);
+}
+
+constexpr Quaterniond Quaterniond::operator +() const
+{
+  return *this;
+}
+
+constexpr Quaterniond Quaterniond::operator -() const
+{
+  return Quaterniond::Create(-w, -x, -y, -z);
+}
+
+constexpr bool Quaterniond::operator ==(const Quaterniond& b) const
+{
+  return w == b.w && x == b.x && y == b.y && z == b.z;
+}
+
+constexpr bool Quaterniond::operator !=(const Quaterniond& b) const
+{
+  return w != b.w || x != b.x || y != b.y || z != b.z;
+}
+
+constexpr Quaterniond Quaterniond::Conjugate(const Quaterniond& v1)
+{
+  return Quaterniond::Create(v1.w, -v1.x, -v1.y, -v1.z);
+}
+
+constexpr double Quaterniond::Dot(const Quaterniond& v1, const Quaterniond& v2)
+{
+  return v1.w * v2.w + v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
+}
+
+} // namespace hydra
+
+namespace std {
+template<>
+struct hash<hydra::Quaterniond>
+{
+public:
+  size_t operator()(const hydra::Quaterniond& s) const
+  {
+    return (size_t)hydra::Hash::Doubles(s.c, 4, 0);
+  }
+};
+} // namespace std
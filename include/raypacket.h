@@ -0,0 +1,77 @@
+//
+//  raypacket.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#pragma once
+
+#include <stdint.h>
+
+#include "vector3.h"
+
+namespace hydra {
+
+// A bundle of up to MAX_RAYS rays stored in structure-of-arrays form, so that
+// one BVH node fetch can be tested against every ray in the packet at once.
+// Packets of 4, 8 or 16 coherent rays are typical; rays that have already
+// terminated are removed from the active mask and skipped during traversal.
+class RayPacket
+{
+public:
+  static const int MAX_RAYS = 16;
+
+  float origin_x[MAX_RAYS];
+  float origin_y[MAX_RAYS];
+  float origin_z[MAX_RAYS];
+  float dir_x[MAX_RAYS];
+  float dir_y[MAX_RAYS];
+  float dir_z[MAX_RAYS];
+  float inv_dir_x[MAX_RAYS];
+  float inv_dir_y[MAX_RAYS];
+  float inv_dir_z[MAX_RAYS];
+  float max_distance[MAX_RAYS];
+  uint32_t active_mask;
+  int count;
+
+  void init(int rayCount);
+  void init(const Vector3* starts, const Vector3* dirs, int rayCount);
+  static RayPacket Create(int rayCount);
+  static RayPacket Create(const Vector3* starts, const Vector3* dirs, int rayCount);
+
+  void setRay(int i, const Vector3& start, const Vector3& dir);
+  void setRay(int i, const Vector3& start, const Vector3& dir, float maxDistance);
+  void deactivate(int i);
+  bool isActive(int i) const;
+
+  Vector3 origin(int i) const;
+  Vector3 direction(int i) const;
+};
+static_assert(std::is_pod<RayPacket>::value, "hydra::RayPacket must be a POD type.");
+
+} // namespace hydra
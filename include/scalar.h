@@ -31,10 +31,21 @@
 
 #pragma once
 
+#include <stdint.h>
+
 namespace hydra {
 
 float SmoothStep(float a, float b, float t);
 float Lerp(float a, float b, float t);
 
+// IEEE 754 binary16 conversion, rounding to nearest even.  Values beyond the
+// half range become infinity; NaN is preserved.
+uint16_t FloatToHalf(float v);
+float HalfToFloat(uint16_t h);
+
+// Signed normalized 16-bit conversion; v is clamped to [-1, 1]
+int16_t FloatToSnorm16(float v);
+float Snorm16ToFloat(int16_t v);
+
 }; // namespace hydra
 
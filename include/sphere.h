@@ -0,0 +1,123 @@
+//
+//  sphere.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Bounding sphere
+
+#pragma once
+
+#include <functional> // for hash<>
+#include <stdint.h>
+
+#include "vector3.h"
+#include "aabb.h"
+#include "plane.h"
+
+namespace hydra {
+
+class Arena;
+class Scheduler;
+
+class Sphere
+{
+public:
+  Vector3 center;
+  float radius;
+
+  void init();
+  void init(const Vector3& center, float radius);
+  void init(const AABB& box); // Circumscribes the box
+  static Sphere Create();
+  static Sphere Create(const Vector3& center, float radius);
+  static Sphere Create(const AABB& box);
+
+  AABB bounds() const;
+  float volume() const;
+  float surfaceArea() const;
+
+  bool contains(const Vector3& p) const;
+  bool contains(const Sphere& b) const;
+  Vector3 nearestPoint(const Vector3& p) const;
+
+  bool intersects(const Sphere& b) const;
+  bool intersects(const AABB& b) const;
+
+  // dir need not be normalized; distance is measured in units of dir and is
+  // zero when the ray starts inside the sphere
+  bool intersectsRay(const Vector3& start, const Vector3& dir) const;
+  bool intersectsRay(const Vector3& start, const Vector3& dir, float& distance) const;
+
+  // The frustum planes have unit normals facing inward.  Returns false only
+  // when the sphere is entirely behind one of the planes, so a sphere near a
+  // frustum corner may be reported as intersecting.
+  bool intersectsFrustum(const Plane* planes, int planeCount) const;
+
+  // Grows the sphere as little as possible to enclose p or b
+  void encapsulate(const Vector3& p);
+  void encapsulate(const Sphere& b);
+  static Sphere Merge(const Sphere& a, const Sphere& b);
+
+  bool operator ==(const Sphere& b) const;
+  bool operator !=(const Sphere& b) const;
+
+  // Ritter's approximate bounding sphere; two passes over the points and
+  // typically within 5-20% of the minimal radius.
+  static Sphere FitRitter(const Vector3* points, size_t count);
+
+  // Welzl's minimal bounding sphere, in expected linear time.  The points are
+  // copied and shuffled internally, into scratch when one is given.
+  static Sphere FitWelzl(const Vector3* points, size_t count);
+  static Sphere FitWelzl(const Vector3* points, size_t count, Arena& scratch);
+
+  // Batch tests over a set of spheres in structure-of-arrays form.  Bit
+  // (i % 32) of mask[i / 32] is set when sphere i passes the test; the mask
+  // must hold (count + 31) / 32 words.  Returns the number of passing spheres.
+  // The Scheduler overloads split the spheres into runs of whole mask words.
+  static size_t BatchIntersects(const Sphere& query, const float* x, const float* y, const float* z, const float* radius, size_t count, uint32_t* mask);
+  static size_t BatchIntersectsFrustum(const Plane* planes, int planeCount, const float* x, const float* y, const float* z, const float* radius, size_t count, uint32_t* mask);
+  static size_t BatchIntersects(const Sphere& query, const float* x, const float* y, const float* z, const float* radius, size_t count, uint32_t* mask, Scheduler& scheduler);
+  static size_t BatchIntersectsFrustum(const Plane* planes, int planeCount, const float* x, const float* y, const float* z, const float* radius, size_t count, uint32_t* mask, Scheduler& scheduler);
+};
+static_assert(std::is_pod<Sphere>::value, "hydra::Sphere must be a POD type.");
+
+} // namespace hydra
+
+namespace std {
+template<>
+struct hash<hydra::Sphere>
+{
+public:
+  size_t operator()(const hydra::Sphere& s) const
+  {
+    uint64_t h = hydra::Hash::Floats(s.center.c, 3, 0);
+    return (size_t)hydra::Hash::Floats(&s.radius, 1, h);
+  }
+};
+} // namespace std
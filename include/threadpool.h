@@ -0,0 +1,120 @@
+//
+//  threadpool.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Data-parallel loops over index ranges, on a built-in worker pool or an
+// external job system
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "alignedallocator.h"
+
+namespace hydra {
+
+// Batch operations that accept a Scheduler split their work with
+// parallelFor().  Implement this interface to run them on an engine's own
+// job system instead of a ThreadPool.
+class Scheduler
+{
+public:
+  virtual ~Scheduler();
+
+  // Calls body(chunkBegin, chunkEnd) for disjoint chunks of at most grain
+  // indices that together cover [begin, end), and returns once every call has
+  // completed.  Calls may run concurrently, on any thread including the
+  // caller's.  grain must be non-zero.
+  virtual void parallelFor(size_t begin, size_t end, size_t grain, const std::function<void(size_t, size_t)>& body) = 0;
+};
+
+// Fixed pool of worker threads, created at construction and sleeping between
+// loops.  Each parallelFor() deals the chunks out evenly between the workers
+// and the calling thread; a thread that runs out of chunks steals half of the
+// remaining chunks of another, so uneven chunk costs still balance.
+//
+// Loops started concurrently from different threads run one after the other.
+// A parallelFor() made from inside a loop body runs serially on the calling
+// thread.
+class ThreadPool : public Scheduler
+{
+public:
+  // threadCount includes the thread calling parallelFor().  A threadCount of
+  // zero uses one thread per hardware thread.
+  ThreadPool(unsigned int threadCount);
+  virtual ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  unsigned int threadCount() const;
+
+  virtual void parallelFor(size_t begin, size_t end, size_t grain, const std::function<void(size_t, size_t)>& body);
+
+private:
+  // The chunks not yet claimed by a thread, as a range of chunk indices with
+  // the first in the low 32 bits and the end in the high 32 bits.  The owner
+  // takes chunks from the front and thieves take them from the back.  Each
+  // queue has a cache line of its own.
+  struct alignas(64) ChunkQueue
+  {
+    std::atomic<uint64_t> chunks;
+  };
+
+  std::vector<std::thread> m_workers;
+  std::vector<ChunkQueue, AlignedAllocator<ChunkQueue> > m_queues; // Index 0 belongs to the calling thread
+
+  std::mutex m_loopMutex; // Held for the duration of each loop
+  std::mutex m_mutex; // Protects the members below
+  std::condition_variable m_wake;
+  std::condition_variable m_done;
+  uint64_t m_generation; // Incremented at the start of each loop
+  unsigned int m_busyWorkers;
+  bool m_exit;
+
+  // The current loop
+  const std::function<void(size_t, size_t)>* m_body;
+  size_t m_begin;
+  size_t m_end;
+  size_t m_grain;
+
+  void workerMain(unsigned int index);
+  void runChunks(unsigned int index);
+  bool steal(unsigned int index);
+};
+
+} // namespace hydra
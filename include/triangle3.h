@@ -31,10 +31,14 @@
 
 #pragma once
 
+#include <stdint.h>
+
 #include "vector3.h"
 
 namespace hydra {
 
+class AABB;
+
 class Triangle3
 {
 public:
@@ -56,7 +60,25 @@ public:
   bool sphereCast(const Vector3& start, const Vector3& dir, float radius, Vector3& hit_point, float& hit_distance) const;
 
   bool containsPoint(const Vector3& p) const;
+
+  // Triangle-triangle intersection test of Moller.  The segment overload also
+  // reports where the triangles cross.  Coplanar triangles that overlap set
+  // coplanar and leave the segment unwritten.
+  bool intersects(const Triangle3& b) const;
+  bool intersects(const Triangle3& b, Vector3& segmentStart, Vector3& segmentEnd, bool& coplanar) const;
+
+  // Separating axis test of Akenine-Moller.  Touching counts as overlapping.
+  bool intersectsAABB(const AABB& box) const;
+
+  // Tests count triangles against one box.  Bit (i % 32) of mask[i / 32] is
+  // set when triangle i overlaps; the mask must hold (count + 31) / 32 words.
+  // Returns the number of overlapping triangles.
+  static size_t IntersectsAABB(const Triangle3* triangles, size_t count, const AABB& box, uint32_t* mask);
   Vector3 closestPointOnTriangle(const Vector3& p) const;
+  Vector3 closestPointOnTriangle(const Vector3& p, Vector2& barycentric) const; // barycentric receives the weights of vert[1] and vert[2]
+
+  // Returns the index of the triangle closest to p, or count if count is zero
+  static size_t ClosestPointOnTriangles(const Triangle3* triangles, size_t count, const Vector3& p, Vector3& closest_point, Vector2& barycentric);
 };
 static_assert(std::is_pod<Triangle3>::value, "hydra::Triangle3 must be a POD type.");
 
@@ -69,10 +91,9 @@ struct hash<hydra::Triangle3>
 public:
   size_t operator()(const hydra::Triangle3& s) const
   {
-    size_t h1 = hash<hydra::Vector3>()(s.vert[0]);
-    size_t h2 = hash<hydra::Vector3>()(s.vert[1]);
-    size_t h3 = hash<hydra::Vector3>()(s.vert[2]);
-    return h1 ^ (h2 << 1) ^ (h3 << 2);
+    uint64_t h = hydra::Hash::Floats(s.vert[0].c, 3, 0);
+    h = hydra::Hash::Floats(s.vert[1].c, 3, h);
+    return (size_t)hydra::Hash::Floats(s.vert[2].c, 3, h);
   }
 };
 } // namespace std
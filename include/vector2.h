@@ -35,6 +35,8 @@
 #include <limits> // for std::numeric_limits<>
 #include <math.h> // for sqrtf
 
+#include "hash.h"
+
 namespace hydra {
 
 class Vector2
@@ -55,24 +57,24 @@ public:
   void init(float v);
   void init(float* v);
   void init(const Vector2& v);
-  static Vector2 Create();
-  static Vector2 Create(float X, float Y);
-  static Vector2 Create(float v);
+  static constexpr Vector2 Create();
+  static constexpr Vector2 Create(float X, float Y);
+  static constexpr Vector2 Create(float v);
   static Vector2 Create(float* v);
-  static Vector2 Create(const Vector2& v);
+  static constexpr Vector2 Create(const Vector2& v);
 
   // Vector2 swizzle getters
-  Vector2 yx() const;
+  constexpr Vector2 yx() const;
 
   // Vector2 swizzle setters
   void yx(const Vector2& v);
 
-  Vector2 operator +(const Vector2& b) const;
-  Vector2 operator -(const Vector2& b) const;
-  Vector2 operator +() const;
-  Vector2 operator -() const;
-  Vector2 operator *(const float v) const;
-  Vector2 operator /(const float v) const;
+  constexpr Vector2 operator +(const Vector2& b) const;
+  constexpr Vector2 operator -(const Vector2& b) const;
+  constexpr Vector2 operator +() const;
+  constexpr Vector2 operator -() const;
+  constexpr Vector2 operator *(const float v) const;
+  constexpr Vector2 operator /(const float v) const;
 
   Vector2& operator +=(const Vector2& b);
   Vector2& operator -=(const Vector2& b);
@@ -83,29 +85,140 @@ public:
   bool operator >(const Vector2& b) const;
   bool operator <(const Vector2& b) const;
 
-  bool operator ==(const Vector2& b) const;
-  bool operator !=(const Vector2& b) const;
+  constexpr bool operator ==(const Vector2& b) const;
+  constexpr bool operator !=(const Vector2& b) const;
 
   float& operator[](unsigned i);
   float operator[](unsigned i) const;
 
-  float sqrMagnitude() const;
+  constexpr float sqrMagnitude() const;
   float magnitude() const;
 
   void normalize();
   static Vector2 Normalize(const Vector2& v);
 
-  static float Cross(const Vector2& v1, const Vector2& v2);
-  static float Dot(const Vector2& v1, const Vector2& v2);
-  static Vector2 Min(const Vector2& v1, const Vector2& v2);
-  static Vector2 Max(const Vector2& v1, const Vector2& v2);
-  static Vector2 Min();
-  static Vector2 Max();
-  static Vector2 Zero();
-  static Vector2 One();
+  static constexpr float Cross(const Vector2& v1, const Vector2& v2);
+  static constexpr float Dot(const Vector2& v1, const Vector2& v2);
+  static constexpr Vector2 Min(const Vector2& v1, const Vector2& v2);
+  static constexpr Vector2 Max(const Vector2& v1, const Vector2& v2);
+  static constexpr Vector2 Min();
+  static constexpr Vector2 Max();
+  static constexpr Vector2 Zero();
+  static constexpr Vector2 One();
 };
 static_assert(std::is_pod<Vector2>::value, "hydra::Vector2 must be a POD type.");
 
+constexpr Vector2 Vector2::Create()
+{
+  return Vector2{ { { 0.0f, 0.0f } } };
+}
+
+constexpr Vector2 Vector2::Create(float X, float Y)
+{
+  return Vector2{ { { X, Y } } };
+}
+
+constexpr Vector2 Vector2::Create(float v)
+{
+  return Vector2{ { { v, v } } };
+}
+
+constexpr Vector2 Vector2::Create(const Vector2& v)
+{
+  return Vector2{ { { v.x, v.y } } };
+}
+
+constexpr Vector2 Vector2::yx() const
+{
+  return Vector2::Create(y, x);
+}
+
+constexpr Vector2 Vector2::Min()
+{
+  return Vector2::Create(-std::numeric_limits<float>::max());
+}
+
+constexpr Vector2 Vector2::Max()
+{
+  return Vector2::Create(std::numeric_limits<float>::max());
+}
+
+constexpr Vector2 Vector2::Zero()
+{
+  return Vector2::Create(0.0f);
+}
+
+constexpr Vector2 Vector2::One()
+{
+  return Vector2::Create(1.0f);
+}
+
+constexpr Vector2 Vector2::operator +(const Vector2& b) const
+{
+  return Vector2::Create(x + b.x, y + b.y);
+}
+
+constexpr Vector2 Vector2::operator -(const Vector2& b) const
+{
+  return Vector2::Create(x - b.x, y - b.y);
+}
+
+constexpr Vector2 Vector2::operator +() const
+{
+  return *this;
+}
+
+constexpr Vector2 Vector2::operator -() const
+{
+  return Vector2::Create(-x, -y);
+}
+
+constexpr Vector2 Vector2::operator *(const float v) const
+{
+  return Vector2::Create(x * v, y * v);
+}
+
+constexpr Vector2 Vector2::operator /(const float v) const
+{
+  float inv_v = 1.0f / v;
+  return Vector2::Create(x * inv_v, y * inv_v);
+}
+
+constexpr bool Vector2::operator ==(const Vector2& b) const
+{
+  return x == b.x && y == b.y;
+}
+
+constexpr bool Vector2::operator !=(const Vector2& b) const
+{
+  return x != b.x || y != b.y;
+}
+
+constexpr float Vector2::sqrMagnitude() const
+{
+  return x * x + y * y;
+}
+
+constexpr float Vector2::Cross(const Vector2& v1, const Vector2& v2)
+{
+  return v1.x * v2.y - v1.y * v2.x;
+}
+
+constexpr float Vector2::Dot(const Vector2& v1, const Vector2& v2)
+{
+  return v1.x * v2.x + v1.y * v2.y;
+}
+
+constexpr Vector2 Vector2::Min(const Vector2& v1, const Vector2& v2)
+{
+  return Vector2::Create((v1.x < v2.x ? v1.x : v2.x), (v1.y < v2.y ? v1.y : v2.y));
+}
+
+constexpr Vector2 Vector2::Max(const Vector2& v1, const Vector2& v2)
+{
+  return Vector2::Create((v1.x > v2.x ? v1.x : v2.x), (v1.y > v2.y ? v1.y : v2.y));
+}
+
 } // namespace hydra
 
 namespace std {
@@ -115,9 +228,7 @@ struct hash<hydra::Vector2>
 public:
   size_t operator()(const hydra::Vector2& s) const
   {
-    size_t h1 = hash<float>()(s.x);
-    size_t h2 = hash<float>()(s.y);
-    return h1 ^ (h2 << 1);
+    return (size_t)hydra::Hash::Floats(s.c, 2, 0);
   }
 };
 } // namespace std
@@ -35,6 +35,8 @@
 #include <limits> // for std::numeric_limits<>
 #include <math.h> // for sqrtf
 
+#include "hash.h"
+
 namespace hydra {
 
 class Vector2i
@@ -55,24 +57,24 @@ public:
   void init(int v);
   void init(int* v);
   void init(const Vector2i& v);
-  static Vector2i Create();
-  static Vector2i Create(int X, int Y);
-  static Vector2i Create(int v);
+  static constexpr Vector2i Create();
+  static constexpr Vector2i Create(int X, int Y);
+  static constexpr Vector2i Create(int v);
   static Vector2i Create(int* v);
-  static Vector2i Create(const Vector2i& v);
+  static constexpr Vector2i Create(const Vector2i& v);
 
   // Vector2 swizzle getters
-  Vector2i yx() const;
+  constexpr Vector2i yx() const;
 
   // Vector2 swizzle setters
   void yx(const Vector2i& v);
 
-  Vector2i operator +(const Vector2i& b) const;
-  Vector2i operator -(const Vector2i& b) const;
-  Vector2i operator +() const;
-  Vector2i operator -() const;
-  Vector2i operator *(const int v) const;
-  Vector2i operator /(const int v) const;
+  constexpr Vector2i operator +(const Vector2i& b) const;
+  constexpr Vector2i operator -(const Vector2i& b) const;
+  constexpr Vector2i operator +() const;
+  constexpr Vector2i operator -() const;
+  constexpr Vector2i operator *(const int v) const;
+  constexpr Vector2i operator /(const int v) const;
 
   Vector2i& operator +=(const Vector2i& b);
   Vector2i& operator -=(const Vector2i& b);
@@ -83,30 +85,140 @@ public:
   bool operator >(const Vector2i& b) const;
   bool operator <(const Vector2i& b) const;
 
-  bool operator ==(const Vector2i& b) const;
-  bool operator !=(const Vector2i& b) const;
+  constexpr bool operator ==(const Vector2i& b) const;
+  constexpr bool operator !=(const Vector2i& b) const;
 
   int& operator[](unsigned i);
   int operator[](unsigned i) const;
 
-  int sqrMagnitude() const;
+  constexpr int sqrMagnitude() const;
   int magnitude() const;
 
   void normalize();
   static Vector2i Normalize(const Vector2i& v);
 
-  static int Cross(const Vector2i& v1, const Vector2i& v2);
-  static int Dot(const Vector2i& v1, const Vector2i& v2);
-  static Vector2i Min(const Vector2i& v1, const Vector2i& v2);
-  static Vector2i Max(const Vector2i& v1, const Vector2i& v2);
+  static constexpr int Cross(const Vector2i& v1, const Vector2i& v2);
+  static constexpr int Dot(const Vector2i& v1, const Vector2i& v2);
+  static constexpr Vector2i Min(const Vector2i& v1, const Vector2i& v2);
+  static constexpr Vector2i Max(const Vector2i& v1, const Vector2i& v2);
 
-  static Vector2i Min();
-  static Vector2i Max();
-  static Vector2i Zero();
-  static Vector2i One();
+  static constexpr Vector2i Min();
+  static constexpr Vector2i Max();
+  static constexpr Vector2i Zero();
+  static constexpr Vector2i One();
 }; // class Vector2i
 static_assert(std::is_pod<Vector2i>::value, "hydra::Vector2i must be a POD type.");
 
+constexpr Vector2i Vector2i::Create()
+{
+  return Vector2i{ { { 0, 0 } } };
+}
+
+constexpr Vector2i Vector2i::Create(int X, int Y)
+{
+  return Vector2i{ { { X, Y } } };
+}
+
+constexpr Vector2i Vector2i::Create(int v)
+{
+  return Vector2i{ { { v, v } } };
+}
+
+constexpr Vector2i Vector2i::Create(const Vector2i& v)
+{
+  return Vector2i{ { { v.x, v.y } } };
+}
+
+constexpr Vector2i Vector2i::yx() const
+{
+  return Vector2i::Create(y, x);
+}
+
+constexpr Vector2i Vector2i::Min()
+{
+  return Vector2i::Create(-std::numeric_limits<int>::max());
+}
+
+constexpr Vector2i Vector2i::Max()
+{
+  return Vector2i::Create(std::numeric_limits<int>::max());
+}
+
+constexpr Vector2i Vector2i::Zero()
+{
+  return Vector2i::Create(0);
+}
+
+constexpr Vector2i Vector2i::One()
+{
+  return Vector2i::Create(1);
+}
+
+constexpr Vector2i Vector2i::operator +(const Vector2i& b) const
+{
+  return Vector2i::Create(x + b.x, y + b.y);
+}
+
+constexpr Vector2i Vector2i::operator -(const Vector2i& b) const
+{
+  return Vector2i::Create(x - b.x, y - b.y);
+}
+
+constexpr Vector2i Vector2i::operator +() const
+{
+  return *this;
+}
+
+constexpr Vector2i Vector2i::operator -() const
+{
+  return Vector2i::Create(-x, -y);
+}
+
+constexpr Vector2i Vector2i::operator *(const int v) const
+{
+  return Vector2i::Create(x * v, y * v);
+}
+
+constexpr Vector2i Vector2i::operator /(const int v) const
+{
+  return Vector2i::Create(x / v, y / v);
+}
+
+constexpr bool Vector2i::operator ==(const Vector2i& b) const
+{
+  return x == b.x && y == b.y;
+}
+
+constexpr bool Vector2i::operator !=(const Vector2i& b) const
+{
+  return x != b.x || y != b.y;
+}
+
+constexpr int Vector2i::sqrMagnitude() const
+{
+  return x * x + y * y;
+}
+
+constexpr int Vector2i::Cross(const Vector2i& v1, const Vector2i& v2)
+{
+  return v1.x * v2.y - v1.y * v2.x;
+}
+
+constexpr int Vector2i::Dot(const Vector2i& v1, const Vector2i& v2)
+{
+  return v1.x * v2.x + v1.y * v2.y;
+}
+
+constexpr Vector2i Vector2i::Min(const Vector2i& v1, const Vector2i& v2)
+{
+  return Vector2i::Create((v1.x < v2.x ? v1.x : v2.x), (v1.y < v2.y ? v1.y : v2.y));
+}
+
+constexpr Vector2i Vector2i::Max(const Vector2i& v1, const Vector2i& v2)
+{
+  return Vector2i::Create((v1.x > v2.x ? v1.x : v2.x), (v1.y > v2.y ? v1.y : v2.y));
+}
+
 } // namespace hydra
 
 namespace std {
@@ -116,9 +228,7 @@ struct hash<hydra::Vector2i>
 public:
   size_t operator()(const hydra::Vector2i& s) const
   {
-    size_t h1 = hash<int>()(s.x);
-    size_t h2 = hash<int>()(s.y);
-    return h1 ^ (h2 << 1);
+    return (size_t)hydra::Hash::Ints(s.c, 2, 0);
   }
 };
 } // namespace std
@@ -58,25 +58,25 @@ public:
   void init(double* v);
   void init(const Vector3& v);
   void init(const Vector4& v);
-  static Vector3 Create();
-  static Vector3 Create(float X, float Y, float Z);
-  static Vector3 Create(float v);
+  static constexpr Vector3 Create();
+  static constexpr Vector3 Create(float X, float Y, float Z);
+  static constexpr Vector3 Create(float v);
   static Vector3 Create(float* v);
   static Vector3 Create(double* v);
-  static Vector3 Create(const Vector3& v);
-  static Vector3 Create(const Vector4& v);
+  static constexpr Vector3 Create(const Vector3& v);
+  static constexpr Vector3 Create(const Vector4& v);
 
 
   // Vector2 swizzle getters
-  Vector2 xx() const;
-  Vector2 xy() const;
-  Vector2 xz() const;
-  Vector2 yx() const;
-  Vector2 yy() const;
-  Vector2 yz() const;
-  Vector2 zx() const;
-  Vector2 zy() const;
-  Vector2 zz() const;
+  constexpr Vector2 xx() const;
+  constexpr Vector2 xy() const;
+  constexpr Vector2 xz() const;
+  constexpr Vector2 yx() const;
+  constexpr Vector2 yy() const;
+  constexpr Vector2 yz() const;
+  constexpr Vector2 zx() const;
+  constexpr Vector2 zy() const;
+  constexpr Vector2 zz() const;
 
   // Vector2 swizzle setters
   void xy(const Vector2& v);
@@ -87,20 +87,20 @@ public:
   void zy(const Vector2& v);
 
   Vector3& operator =(const Vector4& b);
-  Vector3 operator +(const Vector3& b) const;
-  Vector3 operator -(const Vector3& b) const;
-  Vector3 operator +() const;
-  Vector3 operator -() const;
-  Vector3 operator *(const float v) const;
-  Vector3 operator /(const float v) const;
+  constexpr Vector3 operator +(const Vector3& b) const;
+  constexpr Vector3 operator -(const Vector3& b) const;
+  constexpr Vector3 operator +() const;
+  constexpr Vector3 operator -() const;
+  constexpr Vector3 operator *(const float v) const;
+  constexpr Vector3 operator /(const float v) const;
 
   Vector3& operator +=(const Vector3& b);
   Vector3& operator -=(const Vector3& b);
   Vector3& operator *=(const float v);
   Vector3& operator /=(const float v);
 
-  bool operator ==(const Vector3& b) const;
-  bool operator !=(const Vector3& b) const;
+  constexpr bool operator ==(const Vector3& b) const;
+  constexpr bool operator !=(const Vector3& b) const;
 
   // Comparison operators are implemented to allow insertion into sorted containers such as std::set
   bool operator >(const Vector3& b) const;
@@ -109,35 +109,234 @@ public:
   float& operator[](unsigned i);
   float operator[](unsigned i) const;
 
-  float sqrMagnitude() const; // calculate the square of the magnitude (useful for comparison of magnitudes without the cost of a sqrt() function)
+  constexpr float sqrMagnitude() const; // calculate the square of the magnitude (useful for comparison of magnitudes without the cost of a sqrt() function)
   float magnitude() const;
 
   void scale(const Vector3& v);
   void normalize();
   static Vector3 Normalize(const Vector3& v);
 
-  static Vector3 Cross(const Vector3& v1, const Vector3& v2);
-  static float Dot(const Vector3& v1, const Vector3& v2);
-  static Vector3 Min(const Vector3& v1, const Vector3& v2);
-  static Vector3 Max(const Vector3& v1, const Vector3& v2);
-
-  static Vector3 Min();
-  static Vector3 Max();
-  static Vector3 Zero();
-  static Vector3 One();
-  static Vector3 Forward();
-  static Vector3 Backward();
-  static Vector3 Up();
-  static Vector3 Down();
-  static Vector3 Left();
-  static Vector3 Right();
-  static Vector3 Scale(const Vector3& v1, const Vector3& v2);
-  static Vector3 Lerp(const Vector3& v1, const Vector3& v2, float d);
+  static constexpr Vector3 Cross(const Vector3& v1, const Vector3& v2);
+  static constexpr float Dot(const Vector3& v1, const Vector3& v2);
+  static constexpr Vector3 Min(const Vector3& v1, const Vector3& v2);
+  static constexpr Vector3 Max(const Vector3& v1, const Vector3& v2);
+
+  static constexpr Vector3 Min();
+  static constexpr Vector3 Max();
+  static constexpr Vector3 Zero();
+  static constexpr Vector3 One();
+  static constexpr Vector3 Forward();
+  static constexpr Vector3 Backward();
+  static constexpr Vector3 Up();
+  static constexpr Vector3 Down();
+  static constexpr Vector3 Left();
+  static constexpr Vector3 Right();
+  static constexpr Vector3 Scale(const Vector3& v1, const Vector3& v2);
+  static constexpr Vector3 Lerp(const Vector3& v1, const Vector3& v2, float d);
   static Vector3 Slerp(const Vector3& v1, const Vector3& v2, float d);
   static void OrthoNormalize(Vector3& normal, Vector3& tangent); // Gram-Schmidt Orthonormalization
 };
 static_assert(std::is_pod<Vector3>::value, "hydra::Vector3 must be a POD type.");
 
+constexpr Vector3 Vector3::Create()
+{
+  return Vector3{ { { 0.0f, 0.0f, 0.0f } } };
+}
+
+constexpr Vector3 Vector3::Create(float X, float Y, float Z)
+{
+  return Vector3{ { { X, Y, Z } } };
+}
+
+constexpr Vector3 Vector3::Create(float v)
+{
+  return Vector3{ { { v, v, v } } };
+}
+
+constexpr Vector3 Vector3::Create(const Vector3& v)
+{
+  return Vector3{ { { v.x, v.y, v.z } } };
+}
+
+constexpr Vector3 Vector3::Create(const Vector4& v)
+{
+  return Vector3{ { { v.x, v.y, v.z } } };
+}
+
+constexpr Vector2 Vector3::xx() const
+{
+  return Vector2::Create(x, x);
+}
+
+constexpr Vector2 Vector3::xy() const
+{
+  return Vector2::Create(x, y);
+}
+
+constexpr Vector2 Vector3::xz() const
+{
+  return Vector2::Create(x, z);
+}
+
+constexpr Vector2 Vector3::yx() const
+{
+  return Vector2::Create(y, x);
+}
+
+constexpr Vector2 Vector3::yy() const
+{
+  return Vector2::Create(y, y);
+}
+
+constexpr Vector2 Vector3::yz() const
+{
+  return Vector2::Create(y, z);
+}
+
+constexpr Vector2 Vector3::zx() const
+{
+  return Vector2::Create(z, x);
+}
+
+constexpr Vector2 Vector3::zy() const
+{
+  return Vector2::Create(z, y);
+}
+
+constexpr Vector2 Vector3::zz() const
+{
+  return Vector2::Create(z, z);
+}
+
+constexpr Vector3 Vector3::Min()
+{
+  return Vector3::Create(-std::numeric_limits<float>::max());
+}
+
+constexpr Vector3 Vector3::Max()
+{
+  return Vector3::Create(std::numeric_limits<float>::max());
+}
+
+constexpr Vector3 Vector3::Zero()
+{
+  return Vector3::Create();
+}
+
+constexpr Vector3 Vector3::One()
+{
+  return Vector3::Create(1.0f, 1.0f, 1.0f);
+}
+
+constexpr Vector3 Vector3::Forward()
+{
+  return Vector3::Create(0.0f, 0.0f, 1.0f);
+}
+
+constexpr Vector3 Vector3::Backward()
+{
+  return Vector3::Create(0.0f, 0.0f, -1.0f);
+}
+
+constexpr Vector3 Vector3::Up()
+{
+  return Vector3::Create(0.0f, 1.0f, 0.0f);
+}
+
+constexpr Vector3 Vector3::Down()
+{
+  return Vector3::Create(0.0f, -1.0f, 0.0f);
+}
+
+constexpr Vector3 Vector3::Left()
+{
+  return Vector3::Create(-1.0f, 0.0f, 0.0f);
+}
+
+constexpr Vector3 Vector3::Right()
+{
+  return Vector3::Create(1.0f, 0.0f, 0.0f);
+}
+
+constexpr Vector3 Vector3::Scale(const Vector3& v1, const Vector3& v2)
+{
+  return Vector3::Create(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z);
+}
+
+constexpr Vector3 Vector3::Lerp(const Vector3& v1, const Vector3& v2, float d)
+{
+  return v1 + (v2 - v1) * d;
+}
+
+constexpr Vector3 Vector3::operator +(const Vector3& b) const
+{
+  return Vector3::Create(x + b.x, y + b.y, z + b.z);
+}
+
+constexpr Vector3 Vector3::operator -(const Vector3& b) const
+{
+  return Vector3::Create(x - b.x, y - b.y, z - b.z);
+}
+
+constexpr Vector3 Vector3::operator +() const
+{
+  return *this;
+}
+
+constexpr Vector3 Vector3::operator -() const
+{
+  return Vector3::Create(-x, -y, -z);
+}
+
+constexpr Vector3 Vector3::operator *(const float v) const
+{
+  return Vector3::Create(x * v, y * v, z * v);
+}
+
+constexpr Vector3 Vector3::operator /(const float v) const
+{
+  float inv_v = 1.0f / v;
+  return Vector3::Create(x * inv_v, y * inv_v, z * inv_v);
+}
+
+constexpr bool Vector3::operator ==(const Vector3& b) const
+{
+  return x == b.x && y == b.y && z == b.z;
+}
+
+constexpr bool Vector3::operator !=(const Vector3& b) const
+{
+  return x != b.x || y != b.y || z != b.z;
+}
+
+constexpr float Vector3::sqrMagnitude() const
+{
+  // calculate the square of the magnitude (useful for comparison of magnitudes without the cost of a sqrt() function)
+  return x * x + y * y + z * z;
+}
+
+constexpr Vector3 Vector3::Cross(const Vector3& v1, const Vector3& v2)
+{
+  return Vector3::Create(v1.y * v2.z - v1.z * v2.y,
+                         v1.z * v2.x - v1.x * v2.z,
+                         v1.x * v2.y - v1.y * v2.x);
+}
+
+constexpr float Vector3::Dot(const Vector3& v1, const Vector3& v2)
+{
+  return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
+}
+
+constexpr Vector3 Vector3::Min(const Vector3& v1, const Vector3& v2)
+{
+  return Vector3::Create((v1.x < v2.x ? v1.x : v2.x), (v1.y < v2.y ? v1.y : v2.y), (v1.z < v2.z ? v1.z : v2.z));
+}
+
+constexpr Vector3 Vector3::Max(const Vector3& v1, const Vector3& v2)
+{
+  return Vector3::Create((v1.x > v2.x ? v1.x : v2.x), (v1.y > v2.y ? v1.y : v2.y), (v1.z > v2.z ? v1.z : v2.z));
+}
+
 } // namespace hydra
 
 namespace std {
@@ -147,10 +346,7 @@ struct hash<hydra::Vector3>
 public:
   size_t operator()(const hydra::Vector3& s) const
   {
-    size_t h1 = hash<float>()(s.x);
-    size_t h2 = hash<float>()(s.y);
-    size_t h3 = hash<float>()(s.z);
-    return h1 ^ (h2 << 1) ^ (h3 << 2);
+    return (size_t)hydra::Hash::Floats(s.c, 3, 0);
   }
 };
 } // namespace std
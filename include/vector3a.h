@@ -0,0 +1,183 @@
+//
+//  vector3a.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// 3D vector padded to four floats and aligned to 16 bytes, so that it can be
+// moved in and out of SIMD registers with single aligned loads and stores.
+// Converts implicitly to Vector3.
+
+#pragma once
+
+#include <functional> // for hash<>
+
+#include "vector3.h"
+
+namespace hydra {
+
+class alignas(16) Vector3A
+{
+public:
+  union
+  {
+    struct
+    {
+      float x, y, z, w; // w is padding and is kept zero
+    };
+    float c[4];
+  };
+
+  void init(float X, float Y, float Z);
+  void init(const Vector3& v);
+  static constexpr Vector3A Create();
+  static constexpr Vector3A Create(float X, float Y, float Z);
+  static constexpr Vector3A Create(const Vector3& v);
+
+  constexpr operator Vector3() const;
+
+  constexpr Vector3A operator +(const Vector3A& b) const;
+  constexpr Vector3A operator -(const Vector3A& b) const;
+  constexpr Vector3A operator -() const;
+  constexpr Vector3A operator *(const float v) const;
+  constexpr Vector3A operator /(const float v) const;
+
+  constexpr bool operator ==(const Vector3A& b) const;
+  constexpr bool operator !=(const Vector3A& b) const;
+
+  constexpr float sqrMagnitude() const;
+  float magnitude() const;
+
+  static Vector3A Normalize(const Vector3A& v);
+  static constexpr Vector3A Cross(const Vector3A& v1, const Vector3A& v2);
+  static constexpr float Dot(const Vector3A& v1, const Vector3A& v2);
+  static constexpr Vector3A Min(const Vector3A& v1, const Vector3A& v2);
+  static constexpr Vector3A Max(const Vector3A& v1, const Vector3A& v2);
+};
+static_assert(std::is_pod<Vector3A>::value, "hydra::Vector3A must be a POD type.");
+static_assert(sizeof(Vector3A) == 16 && alignof(Vector3A) == 16, "hydra::Vector3A must be 16 bytes and 16 byte aligned.");
+
+constexpr Vector3A Vector3A::Create()
+{
+  return Vector3A{ { { 0.0f, 0.0f, 0.0f, 0.0f } } };
+}
+
+constexpr Vector3A Vector3A::Create(float X, float Y, float Z)
+{
+  return Vector3A{ { { X, Y, Z, 0.0f } } };
+}
+
+constexpr Vector3A Vector3A::Create(const Vector3& v)
+{
+  return Vector3A{ { { v.x, v.y, v.z, 0.0f } } };
+}
+
+constexpr Vector3A::operator Vector3() const
+{
+  return Vector3::Create(x, y, z);
+}
+
+// Arithmetic is written over all four lanes, so that the compiler can
+// vectorize it; the zero padding stays zero through every operation
+
+constexpr Vector3A Vector3A::operator +(const Vector3A& b) const
+{
+  return Vector3A{ { { x + b.x, y + b.y, z + b.z, w + b.w } } };
+}
+
+constexpr Vector3A Vector3A::operator -(const Vector3A& b) const
+{
+  return Vector3A{ { { x - b.x, y - b.y, z - b.z, w - b.w } } };
+}
+
+constexpr Vector3A Vector3A::operator -() const
+{
+  return Vector3A{ { { -x, -y, -z, w } } };
+}
+
+constexpr Vector3A Vector3A::operator *(const float v) const
+{
+  return Vector3A{ { { x * v, y * v, z * v, w * v } } };
+}
+
+constexpr Vector3A Vector3A::operator /(const float v) const
+{
+  float inv_v = 1.0f / v;
+  return Vector3A{ { { x * inv_v, y * inv_v, z * inv_v, 0.0f } } };
+}
+
+constexpr bool Vector3A::operator ==(const Vector3A& b) const
+{
+  return x == b.x && y == b.y && z == b.z;
+}
+
+constexpr bool Vector3A::operator !=(const Vector3A& b) const
+{
+  return x != b.x || y != b.y || z != b.z;
+}
+
+constexpr float Vector3A::sqrMagnitude() const
+{
+  return x * x + y * y + z * z;
+}
+
+constexpr Vector3A Vector3A::Cross(const Vector3A& v1, const Vector3A& v2)
+{
+  return Vector3A::Create(v1.y * v2.z - v1.z * v2.y,
+                          v1.z * v2.x - v1.x * v2.z,
+                          v1.x * v2.y - v1.y * v2.x);
+}
+
+constexpr float Vector3A::Dot(const Vector3A& v1, const Vector3A& v2)
+{
+  return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
+}
+
+constexpr Vector3A Vector3A::Min(const Vector3A& v1, const Vector3A& v2)
+{
+  return Vector3A{ { { (v1.x < v2.x ? v1.x : v2.x), (v1.y < v2.y ? v1.y : v2.y), (v1.z < v2.z ? v1.z : v2.z), 0.0f } } };
+}
+
+constexpr Vector3A Vector3A::Max(const Vector3A& v1, const Vector3A& v2)
+{
+  return Vector3A{ { { (v1.x > v2.x ? v1.x : v2.x), (v1.y > v2.y ? v1.y : v2.y), (v1.z > v2.z ? v1.z : v2.z), 0.0f } } };
+}
+
+} // namespace hydra
+
+namespace std {
+template<>
+struct hash<hydra::Vector3A>
+{
+public:
+  size_t operator()(const hydra::Vector3A& s) const
+  {
+    return (size_t)hydra::Hash::Floats(s.c, 3, 0);
+  }
+};
+} // namespace std
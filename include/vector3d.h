@@ -0,0 +1,298 @@
+//
+//  vector3d.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Double precision 3D vector, for world space positions that exceed the
+// useful range of a float
+
+#pragma once
+
+#include <functional> // for hash<>
+
+#include "vector3.h"
+
+namespace hydra {
+
+class Vector3d
+{
+
+public:
+  union
+  {
+    struct
+    {
+      double x, y, z;
+    };
+    double c[3];
+  };
+
+  void init();
+  void init(double X, double Y, double Z);
+  void init(double v);
+  void init(double* v);
+  void init(const Vector3d& v);
+  void init(const Vector3& v);
+  static constexpr Vector3d Create();
+  static constexpr Vector3d Create(double X, double Y, double Z);
+  static constexpr Vector3d Create(double v);
+  static Vector3d Create(double* v);
+  static constexpr Vector3d Create(const Vector3d& v);
+  static constexpr Vector3d Create(const Vector3& v);
+
+  // Converts to single precision, losing precision for large coordinates
+  constexpr Vector3 asVector3() const;
+  // Converts the offset from origin to single precision
+  constexpr Vector3 asVector3(const Vector3d& origin) const;
+
+  constexpr Vector3d operator +(const Vector3d& b) const;
+  constexpr Vector3d operator -(const Vector3d& b) const;
+  constexpr Vector3d operator +() const;
+  constexpr Vector3d operator -() const;
+  constexpr Vector3d operator *(const double v) const;
+  constexpr Vector3d operator /(const double v) const;
+
+  Vector3d& operator +=(const Vector3d& b);
+  Vector3d& operator -=(const Vector3d& b);
+  Vector3d& operator *=(const double v);
+  Vector3d& operator /=(const double v);
+
+  constexpr bool operator ==(const Vector3d& b) const;
+  constexpr bool operator !=(const Vector3d& b) const;
+
+  // Comparison operators are implemented to allow insertion into sorted containers such as std::set
+  bool operator >(const Vector3d& b) const;
+  bool operator <(const Vector3d& b) const;
+
+  double& operator[](unsigned i);
+  double operator[](unsigned i) const;
+
+  constexpr double sqrMagnitude() const; // calculate the square of the magnitude (useful for comparison of magnitudes without the cost of a sqrt() function)
+  double magnitude() const;
+
+  void scale(const Vector3d& v);
+  void normalize();
+  static Vector3d Normalize(const Vector3d& v);
+
+  static constexpr Vector3d Cross(const Vector3d& v1, const Vector3d& v2);
+  static constexpr double Dot(const Vector3d& v1, const Vector3d& v2);
+  static constexpr Vector3d Min(const Vector3d& v1, const Vector3d& v2);
+  static constexpr Vector3d Max(const Vector3d& v1, const Vector3d& v2);
+
+  static constexpr Vector3d Min();
+  static constexpr Vector3d Max();
+  static constexpr Vector3d Zero();
+  static constexpr Vector3d One();
+  static constexpr Vector3d Forward();
+  static constexpr Vector3d Backward();
+  static constexpr Vector3d Up();
+  static constexpr Vector3d Down();
+  static constexpr Vector3d Left();
+  static constexpr Vector3d Right();
+  static constexpr Vector3d Scale(const Vector3d& v1, const Vector3d& v2);
+  static constexpr Vector3d Lerp(const Vector3d& v1, const Vector3d& v2, double d);
+};
+static_assert(std::is_pod<Vector3d>::value, "hydra::Vector3d must be a POD type.");
+
+constexpr Vector3d Vector3d::Create()
+{
+  return Vector3d{ { { 0.0, 0.0, 0.0 } } };
+}
+
+constexpr Vector3d Vector3d::Create(double X, double Y, double Z)
+{
+  return Vector3d{ { { X, Y, Z } } };
+}
+
+constexpr Vector3d Vector3d::Create(double v)
+{
+  return Vector3d{ { { v, v, v } } };
+}
+
+constexpr Vector3d Vector3d::Create(const Vector3d& v)
+{
+  return Vector3d{ { { v.x, v.y, v.z } } };
+}
+
+constexpr Vector3d Vector3d::Create(const Vector3& v)
+{
+  return Vector3d{ { { (double)v.x, (double)v.y, (double)v.z } } };
+}
+
+constexpr Vector3 Vector3d::asVector3() const
+{
+  return Vector3::Create((float)x, (float)y, (float)z);
+}
+
+constexpr Vector3 Vector3d::asVector3(const Vector3d& origin) const
+{
+  return Vector3::Create((float)(x - origin.x), (float)(y - origin.y), (float)(z - origin.z));
+}
+
+constexpr Vector3d Vector3d::operator +(const Vector3d& b) const
+{
+  return Vector3d::Create(x + b.x, y + b.y, z + b.z);
+}
+
+constexpr Vector3d Vector3d::operator -(const Vector3d& b) const
+{
+  return Vector3d::Create(x - b.x, y - b.y, z - b.z);
+}
+
+constexpr Vector3d Vector3d::operator +() const
+{
+  return *this;
+}
+
+constexpr Vector3d Vector3d::operator -() const
+{
+  return Vector3d::Create(-x, -y, -z);
+}
+
+constexpr Vector3d Vector3d::operator *(const double v) const
+{
+  return Vector3d::Create(x * v, y * v, z * v);
+}
+
+constexpr Vector3d Vector3d::operator /(const double v) const
+{
+  double inv_v = 1.0 / v;
+  return Vector3d::Create(x * inv_v, y * inv_v, z * inv_v);
+}
+
+constexpr bool Vector3d::operator ==(const Vector3d& b) const
+{
+  return x == b.x && y == b.y && z == b.z;
+}
+
+constexpr bool Vector3d::operator !=(const Vector3d& b) const
+{
+  return x != b.x || y != b.y || z != b.z;
+}
+
+constexpr double Vector3d::sqrMagnitude() const
+{
+  return x * x + y * y + z * z;
+}
+
+constexpr Vector3d Vector3d::Cross(const Vector3d& v1, const Vector3d& v2)
+{
+  return Vector3d::Create(v1.y * v2.z - v1.z * v2.y,
+                          v1.z * v2.x - v1.x * v2.z,
+                          v1.x * v2.y - v1.y * v2.x);
+}
+
+constexpr double Vector3d::Dot(const Vector3d& v1, const Vector3d& v2)
+{
+  return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
+}
+
+constexpr Vector3d Vector3d::Min(const Vector3d& v1, const Vector3d& v2)
+{
+  return Vector3d::Create((v1.x < v2.x ? v1.x : v2.x), (v1.y < v2.y ? v1.y : v2.y), (v1.z < v2.z ? v1.z : v2.z));
+}
+
+constexpr Vector3d Vector3d::Max(const Vector3d& v1, const Vector3d& v2)
+{
+  return Vector3d::Create((v1.x > v2.x ? v1.x : v2.x), (v1.y > v2.y ? v1.y : v2.y), (v1.z > v2.z ? v1.z : v2.z));
+}
+
+constexpr Vector3d Vector3d::Min()
+{
+  return Vector3d::Create(-std::numeric_limits<double>::max());
+}
+
+constexpr Vector3d Vector3d::Max()
+{
+  return Vector3d::Create(std::numeric_limits<double>::max());
+}
+
+constexpr Vector3d Vector3d::Zero()
+{
+  return Vector3d::Create();
+}
+
+constexpr Vector3d Vector3d::One()
+{
+  return Vector3d::Create(1.0, 1.0, 1.0);
+}
+
+constexpr Vector3d Vector3d::Forward()
+{
+  return Vector3d::Create(0.0, 0.0, 1.0);
+}
+
+constexpr Vector3d Vector3d::Backward()
+{
+  return Vector3d::Create(0.0, 0.0, -1.0);
+}
+
+constexpr Vector3d Vector3d::Up()
+{
+  return Vector3d::Create(0.0, 1.0, 0.0);
+}
+
+constexpr Vector3d Vector3d::Down()
+{
+  return Vector3d::Create(0.0, -1.0, 0.0);
+}
+
+constexpr Vector3d Vector3d::Left()
+{
+  return Vector3d::Create(-1.0, 0.0, 0.0);
+}
+
+constexpr Vector3d Vector3d::Right()
+{
+  return Vector3d::Create(1.0, 0.0, 0.0);
+}
+
+constexpr Vector3d Vector3d::Scale(const Vector3d& v1, const Vector3d& v2)
+{
+  return Vector3d::Create(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z);
+}
+
+constexpr Vector3d Vector3d::Lerp(const Vector3d& v1, const Vector3d& v2, double d)
+{
+  return v1 + (v2 - v1) * d;
+}
+
+} // namespace hydra
+
+namespace std {
+template<>
+struct hash<hydra::Vector3d>
+{
+public:
+  size_t operator()(const hydra::Vector3d& s) const
+  {
+    return (size_t)hydra::Hash::Doubles(s.c, 3, 0);
+  }
+};
+} // namespace std
@@ -55,23 +55,23 @@ public:
   void init(int v);
   void init(int* v);
   void init(const Vector3i& v);
-  static Vector3i Create();
-  static Vector3i Create(int X, int Y, int Z);
-  static Vector3i Create(int v);
+  static constexpr Vector3i Create();
+  static constexpr Vector3i Create(int X, int Y, int Z);
+  static constexpr Vector3i Create(int v);
   static Vector3i Create(int* v);
-  static Vector3i Create(const Vector3i& v);
+  static constexpr Vector3i Create(const Vector3i& v);
 
 
   // Vector2 swizzle getters
-  Vector2i xx() const;
-  Vector2i xy() const;
-  Vector2i xz() const;
-  Vector2i yx() const;
-  Vector2i yy() const;
-  Vector2i yz() const;
-  Vector2i zx() const;
-  Vector2i zy() const;
-  Vector2i zz() const;
+  constexpr Vector2i xx() const;
+  constexpr Vector2i xy() const;
+  constexpr Vector2i xz() const;
+  constexpr Vector2i yx() const;
+  constexpr Vector2i yy() const;
+  constexpr Vector2i yz() const;
+  constexpr Vector2i zx() const;
+  constexpr Vector2i zy() const;
+  constexpr Vector2i zz() const;
 
   // Vector2 swizzle setters
   void xy(const Vector2i& v);
@@ -81,20 +81,20 @@ public:
   void zx(const Vector2i& v);
   void zy(const Vector2i& v);
 
-  Vector3i operator +(const Vector3i& b) const;
-  Vector3i operator -(const Vector3i& b) const;
-  Vector3i operator +() const;
-  Vector3i operator -() const;
-  Vector3i operator *(const int v) const;
-  Vector3i operator /(const int v) const;
+  constexpr Vector3i operator +(const Vector3i& b) const;
+  constexpr Vector3i operator -(const Vector3i& b) const;
+  constexpr Vector3i operator +() const;
+  constexpr Vector3i operator -() const;
+  constexpr Vector3i operator *(const int v) const;
+  constexpr Vector3i operator /(const int v) const;
 
   Vector3i& operator +=(const Vector3i& b);
   Vector3i& operator -=(const Vector3i& b);
   Vector3i& operator *=(const int v);
   Vector3i& operator /=(const int v);
 
-  bool operator ==(const Vector3i& b) const;
-  bool operator !=(const Vector3i& b) const;
+  constexpr bool operator ==(const Vector3i& b) const;
+  constexpr bool operator !=(const Vector3i& b) const;
 
   // Comparison operators are implemented to allow insertion into sorted containers such as std::set
   bool operator >(const Vector3i& b) const;
@@ -103,30 +103,218 @@ public:
   int& operator[](unsigned i);
   int operator[](unsigned i) const;
 
-  int sqrMagnitude() const; // calculate the square of the magnitude (useful for comparison of magnitudes without the cost of a sqrt() function)
+  constexpr int sqrMagnitude() const; // calculate the square of the magnitude (useful for comparison of magnitudes without the cost of a sqrt() function)
   int magnitude() const;
 
   void scale(const Vector3i& v);
 
-  static Vector3i Cross(const Vector3i& v1, const Vector3i& v2);
-  static int Dot(const Vector3i& v1, const Vector3i& v2);
-  static Vector3i Min(const Vector3i& v1, const Vector3i& v2);
-  static Vector3i Max(const Vector3i& v1, const Vector3i& v2);
-
-  static Vector3i Min();
-  static Vector3i Max();
-  static Vector3i Zero();
-  static Vector3i One();
-  static Vector3i Forward();
-  static Vector3i Backward();
-  static Vector3i Up();
-  static Vector3i Down();
-  static Vector3i Left();
-  static Vector3i Right();
-  static Vector3i Scale(const Vector3i& v1, const Vector3i& v2);
+  static constexpr Vector3i Cross(const Vector3i& v1, const Vector3i& v2);
+  static constexpr int Dot(const Vector3i& v1, const Vector3i& v2);
+  static constexpr Vector3i Min(const Vector3i& v1, const Vector3i& v2);
+  static constexpr Vector3i Max(const Vector3i& v1, const Vector3i& v2);
+
+  static constexpr Vector3i Min();
+  static constexpr Vector3i Max();
+  static constexpr Vector3i Zero();
+  static constexpr Vector3i One();
+  static constexpr Vector3i Forward();
+  static constexpr Vector3i Backward();
+  static constexpr Vector3i Up();
+  static constexpr Vector3i Down();
+  static constexpr Vector3i Left();
+  static constexpr Vector3i Right();
+  static constexpr Vector3i Scale(const Vector3i& v1, const Vector3i& v2);
 };
 static_assert(std::is_pod<Vector3i>::value, "hydra::Vector3i must be a POD type.");
 
+constexpr Vector3i Vector3i::Create()
+{
+  return Vector3i{ { { 0, 0, 0 } } };
+}
+
+constexpr Vector3i Vector3i::Create(int X, int Y, int Z)
+{
+  return Vector3i{ { { X, Y, Z } } };
+}
+
+constexpr Vector3i Vector3i::Create(int v)
+{
+  return Vector3i{ { { v, v, v } } };
+}
+
+constexpr Vector3i Vector3i::Create(const Vector3i& v)
+{
+  return Vector3i{ { { v.x, v.y, v.z } } };
+}
+
+constexpr Vector2i Vector3i::xx() const
+{
+  return Vector2i::Create(x, x);
+}
+
+constexpr Vector2i Vector3i::xy() const
+{
+  return Vector2i::Create(x, y);
+}
+
+constexpr Vector2i Vector3i::xz() const
+{
+  return Vector2i::Create(x, z);
+}
+
+constexpr Vector2i Vector3i::yx() const
+{
+  return Vector2i::Create(y, x);
+}
+
+constexpr Vector2i Vector3i::yy() const
+{
+  return Vector2i::Create(y, y);
+}
+
+constexpr Vector2i Vector3i::yz() const
+{
+  return Vector2i::Create(y, z);
+}
+
+constexpr Vector2i Vector3i::zx() const
+{
+  return Vector2i::Create(z, x);
+}
+
+constexpr Vector2i Vector3i::zy() const
+{
+  return Vector2i::Create(z, y);
+}
+
+constexpr Vector2i Vector3i::zz() const
+{
+  return Vector2i::Create(z, z);
+}
+
+constexpr Vector3i Vector3i::Min()
+{
+  return Vector3i::Create(-std::numeric_limits<int>::max());
+}
+
+constexpr Vector3i Vector3i::Max()
+{
+  return Vector3i::Create(std::numeric_limits<int>::max());
+}
+
+constexpr Vector3i Vector3i::Zero()
+{
+  return Vector3i::Create();
+}
+
+constexpr Vector3i Vector3i::One()
+{
+  return Vector3i::Create(1,1,1);
+}
+
+constexpr Vector3i Vector3i::Forward()
+{
+  return Vector3i::Create(0, 0, 1);
+}
+
+constexpr Vector3i Vector3i::Backward()
+{
+  return Vector3i::Create(0, 0, -1);
+}
+
+constexpr Vector3i Vector3i::Up()
+{
+  return Vector3i::Create(0,1,0);
+}
+
+constexpr Vector3i Vector3i::Down()
+{
+  return Vector3i::Create(0, -1, 0);
+}
+
+constexpr Vector3i Vector3i::Left()
+{
+  return Vector3i::Create(-1, 0, 0);
+}
+
+constexpr Vector3i Vector3i::Right()
+{
+  return Vector3i::Create(1,0,0);
+}
+
+constexpr Vector3i Vector3i::Scale(const Vector3i& v1, const Vector3i& v2)
+{
+  return Vector3i::Create(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z);
+}
+
+constexpr Vector3i Vector3i::operator +(const Vector3i& b) const
+{
+  return Vector3i::Create(x + b.x, y + b.y, z + b.z);
+}
+
+constexpr Vector3i Vector3i::operator -(const Vector3i& b) const
+{
+  return Vector3i::Create(x - b.x, y - b.y, z - b.z);
+}
+
+constexpr Vector3i Vector3i::operator +() const
+{
+  return *this;
+}
+
+constexpr Vector3i Vector3i::operator -() const
+{
+  return Vector3i::Create(-x, -y, -z);
+}
+
+constexpr Vector3i Vector3i::operator *(const int v) const
+{
+  return Vector3i::Create(x * v, y * v, z * v);
+}
+
+constexpr Vector3i Vector3i::operator /(const int v) const
+{
+  return Vector3i::Create(x / v, y / v, z / v);
+}
+
+constexpr bool Vector3i::operator ==(const Vector3i& b) const
+{
+  return x == b.x && y == b.y && z == b.z;
+}
+
+constexpr bool Vector3i::operator !=(const Vector3i& b) const
+{
+  return x != b.x || y != b.y || z != b.z;
+}
+
+constexpr int Vector3i::sqrMagnitude() const
+{
+  // calculate the square of the magnitude (useful for comparison of magnitudes without the cost of a sqrt() function)
+  return x * x + y * y + z * z;
+}
+
+constexpr Vector3i Vector3i::Cross(const Vector3i& v1, const Vector3i& v2)
+{
+  return Vector3i::Create(v1.y * v2.z - v1.z * v2.y,
+                          v1.z * v2.x - v1.x * v2.z,
+                          v1.x * v2.y - v1.y * v2.x);
+}
+
+constexpr int Vector3i::Dot(const Vector3i& v1, const Vector3i& v2)
+{
+  return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
+}
+
+constexpr Vector3i Vector3i::Min(const Vector3i& v1, const Vector3i& v2)
+{
+  return Vector3i::Create((v1.x < v2.x ? v1.x : v2.x), (v1.y < v2.y ? v1.y : v2.y), (v1.z < v2.z ? v1.z : v2.z));
+}
+
+constexpr Vector3i Vector3i::Max(const Vector3i& v1, const Vector3i& v2)
+{
+  return Vector3i::Create((v1.x > v2.x ? v1.x : v2.x), (v1.y > v2.y ? v1.y : v2.y), (v1.z > v2.z ? v1.z : v2.z));
+}
+
 } // namespace hydra
 
 namespace std {
@@ -136,10 +324,7 @@ struct hash<hydra::Vector3i>
 public:
   size_t operator()(const hydra::Vector3i& s) const
   {
-    size_t h1 = hash<int>()(s.x);
-    size_t h2 = hash<int>()(s.y);
-    size_t h3 = hash<int>()(s.z);
-    return h1 ^ (h2 << 1) ^ (h3 << 2);
+    return (size_t)hydra::Hash::Ints(s.c, 3, 0);
   }
 };
 } // namespace std
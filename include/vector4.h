@@ -32,6 +32,9 @@
 #pragma once
 
 #include <functional> // for hash<>
+#include <limits> // for std::numeric_limits<>
+
+#include "hash.h"
 
 namespace hydra {
 
@@ -56,27 +59,27 @@ public:
   void init(float* v);
   void init(const Vector4& v);
   void init(const Vector3& v, float W);
-  static Vector4 Create();
-  static Vector4 Create(float X, float Y, float Z, float W);
-  static Vector4 Create(float v);
+  static constexpr Vector4 Create();
+  static constexpr Vector4 Create(float X, float Y, float Z, float W);
+  static constexpr Vector4 Create(float v);
   static Vector4 Create(float* v);
-  static Vector4 Create(const Vector4& v);
+  static constexpr Vector4 Create(const Vector4& v);
   static Vector4 Create(const Vector3& v, float W);
 
-  Vector4 operator +(const Vector4& b) const;
-  Vector4 operator -(const Vector4& b) const;
-  Vector4 operator +() const;
-  Vector4 operator -() const;
-  Vector4 operator *(const float v) const;
-  Vector4 operator /(const float v) const;
+  constexpr Vector4 operator +(const Vector4& b) const;
+  constexpr Vector4 operator -(const Vector4& b) const;
+  constexpr Vector4 operator +() const;
+  constexpr Vector4 operator -() const;
+  constexpr Vector4 operator *(const float v) const;
+  constexpr Vector4 operator /(const float v) const;
 
   Vector4& operator +=(const Vector4& b);
   Vector4& operator -=(const Vector4& b);
   Vector4& operator *=(const float v);
   Vector4& operator /=(const float v);
 
-  bool operator ==(const Vector4& b) const;
-  bool operator !=(const Vector4& b) const;
+  constexpr bool operator ==(const Vector4& b) const;
+  constexpr bool operator !=(const Vector4& b) const;
 
   // Comparison operators are implemented to allow insertion into sorted containers such as std::set
   bool operator >(const Vector4& b) const;
@@ -85,32 +88,168 @@ public:
   float& operator[](unsigned i);
   float operator[](unsigned i) const;
 
-  float sqrMagnitude() const; // calculate the square of the magnitude (useful for comparison of magnitudes without the cost of a sqrt() function)
+  constexpr float sqrMagnitude() const; // calculate the square of the magnitude (useful for comparison of magnitudes without the cost of a sqrt() function)
   float magnitude() const;
 
   void normalize();
   static Vector4 Normalize(const Vector4& v);
 
-  static float Dot(const Vector4& v1, const Vector4& v2);
-  static Vector4 Min(const Vector4& v1, const Vector4& v2);
-  static Vector4 Max(const Vector4& v1, const Vector4& v2);
-
-  static Vector4 Min();
-  static Vector4 Max();
-  static Vector4 Zero();
-  static Vector4 One();
-  static Vector4 Forward();
-  static Vector4 Backward();
-  static Vector4 Up();
-  static Vector4 Down();
-  static Vector4 Left();
-  static Vector4 Right();
-  static Vector4 Lerp(const Vector4& v1, const Vector4& v2, float d);
+  static constexpr float Dot(const Vector4& v1, const Vector4& v2);
+  static constexpr Vector4 Min(const Vector4& v1, const Vector4& v2);
+  static constexpr Vector4 Max(const Vector4& v1, const Vector4& v2);
+
+  static constexpr Vector4 Min();
+  static constexpr Vector4 Max();
+  static constexpr Vector4 Zero();
+  static constexpr Vector4 One();
+  static constexpr Vector4 Forward();
+  static constexpr Vector4 Backward();
+  static constexpr Vector4 Up();
+  static constexpr Vector4 Down();
+  static constexpr Vector4 Left();
+  static constexpr Vector4 Right();
+  static constexpr Vector4 Lerp(const Vector4& v1, const Vector4& v2, float d);
   static Vector4 Slerp(const Vector4& v1, const Vector4& v2, float d);
   static void OrthoNormalize(Vector4& normal, Vector4& tangent); // Gram-Schmidt Orthonormalization
 };
 static_assert(std::is_pod<Vector4>::value, "hydra::Vector4 must be a POD type.");
 
+constexpr Vector4 Vector4::Create()
+{
+  return Vector4{ { { 0.0f, 0.0f, 0.0f, 0.0f } } };
+}
+
+constexpr Vector4 Vector4::Create(float X, float Y, float Z, float W)
+{
+  return Vector4{ { { X, Y, Z, W } } };
+}
+
+constexpr Vector4 Vector4::Create(float v)
+{
+  return Vector4{ { { v, v, v, v } } };
+}
+
+constexpr Vector4 Vector4::Create(const Vector4& v)
+{
+  return Vector4{ { { v.x, v.y, v.z, v.w } } };
+}
+
+constexpr Vector4 Vector4::Min()
+{
+  return Vector4::Create(-std::numeric_limits<float>::max());
+}
+
+constexpr Vector4 Vector4::Max()
+{
+  return Vector4::Create(std::numeric_limits<float>::max());
+}
+
+constexpr Vector4 Vector4::Zero()
+{
+  return Vector4::Create();
+}
+
+constexpr Vector4 Vector4::One()
+{
+  return Vector4::Create(1.0f, 1.0f, 1.0f, 1.0f);
+}
+
+constexpr Vector4 Vector4::Forward()
+{
+  return Vector4::Create(0.0f, 0.0f, 1.0f, 1.0f);
+}
+
+constexpr Vector4 Vector4::Backward()
+{
+  return Vector4::Create(0.0f, 0.0f, -1.0f, 1.0f);
+}
+
+constexpr Vector4 Vector4::Up()
+{
+  return Vector4::Create(0.0f, 1.0f, 0.0f, 1.0f);
+}
+
+constexpr Vector4 Vector4::Down()
+{
+  return Vector4::Create(0.0f, -1.0f, 0.0f, 1.0f);
+}
+
+constexpr Vector4 Vector4::Left()
+{
+  return Vector4::Create(-1.0f, 0.0f, 0.0f, 1.0f);
+}
+
+constexpr Vector4 Vector4::Right()
+{
+  return Vector4::Create(1.0f, 0.0f, 0.0f, 1.0f);
+}
+
+constexpr Vector4 Vector4::Lerp(const Vector4& v1, const Vector4& v2, float d)
+{
+  return v1 + (v2 - v1) * d;
+}
+
+constexpr Vector4 Vector4::operator +(const Vector4& b) const
+{
+  return Vector4::Create(x + b.x, y + b.y, z + b.z, w + b.w);
+}
+
+constexpr Vector4 Vector4::operator -(const Vector4& b) const
+{
+  return Vector4::Create(x - b.x, y - b.y, z - b.z, w - b.w);
+}
+
+constexpr Vector4 Vector4::operator +() const
+{
+  return *this;
+}
+
+constexpr Vector4 Vector4::operator -() const
+{
+  return Vector4::Create(-x, -y, -z, -w);
+}
+
+constexpr Vector4 Vector4::operator *(const float v) const
+{
+  return Vector4::Create(x * v, y * v, z * v, w * v);
+}
+
+constexpr Vector4 Vector4::operator /(const float v) const
+{
+  return Vector4::Create(x / v, y / v, z / v, w / v);
+}
+
+constexpr bool Vector4::operator ==(const Vector4& b) const
+{
+  return x == b.x && y == b.y && z == b.z && w == b.w;
+}
+
+constexpr bool Vector4::operator !=(const Vector4& b) const
+{
+  return x != b.x || y != b.y || z != b.z || w != b.w;
+}
+
+constexpr float Vector4::sqrMagnitude() const
+{
+  // calculate the square of the magnitude (useful for comparison of magnitudes without the cost of a sqrt() function)
+  return x * x + y * y + z * z + w * w;
+}
+
+constexpr float Vector4::Dot(const Vector4& v1, const Vector4& v2)
+{
+  return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z + v1.w * v2.w;
+}
+
+constexpr Vector4 Vector4::Min(const Vector4& v1, const Vector4& v2)
+{
+  return Vector4::Create((v1.x < v2.x ? v1.x : v2.x), (v1.y < v2.y ? v1.y : v2.y), (v1.z < v2.z ? v1.z : v2.z), (v1.w < v2.w ? v1.w : v2.w));
+}
+
+constexpr Vector4 Vector4::Max(const Vector4& v1, const Vector4& v2)
+{
+  return Vector4::Create((v1.x > v2.x ? v1.x : v2.x), (v1.y > v2.y ? v1.y : v2.y), (v1.z > v2.z ? v1.z : v2.z), (v1.w > v2.w ? v1.w : v2.w));
+}
+
 } // namespace hydra
 
 namespace std {
@@ -120,11 +259,7 @@ struct hash<hydra::Vector4>
 public:
   size_t operator()(const hydra::Vector4& s) const
   {
-    size_t h1 = hash<float>()(s.x);
-    size_t h2 = hash<float>()(s.y);
-    size_t h3 = hash<float>()(s.z);
-    size_t h4 = hash<float>()(s.w);
-    return h1 ^ (h2 << 1) ^ (h3 << 2) ^ (h4 << 3);
+    return (size_t)hydra::Hash::Floats(s.c, 4, 0);
   }
 };
 } // namespace std
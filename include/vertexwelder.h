@@ -0,0 +1,62 @@
+//
+//  vertexwelder.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Vertex welding and deduplication
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "vector3.h"
+
+namespace hydra {
+
+class Arena;
+
+class VertexWelder
+{
+public:
+  // Merges each vertex into the first earlier vertex that lies within
+  // epsilon of it, using a spatial hash with cells of size 2 * epsilon so
+  // that at most 8 neighboring cells are probed per vertex.  An epsilon of
+  // zero merges only exactly equal vertices, treating -0.0 and 0.0 as equal.
+  // Vertices with non-finite coordinates are never merged.
+  //
+  // weldedVertices receives the surviving vertices in order of first
+  // appearance, and remap receives, for each input vertex, the index of the
+  // welded vertex that replaces it.  Returns the number of welded vertices.
+  static size_t Weld(const Vector3* vertices, size_t count, float epsilon, std::vector<Vector3>& weldedVertices, std::vector<uint32_t>& remap);
+  // As above, taking the spatial hash from scratch rather than the heap
+  static size_t Weld(const Vector3* vertices, size_t count, float epsilon, std::vector<Vector3>& weldedVertices, std::vector<uint32_t>& remap, Arena& scratch);
+};
+
+} // namespace hydra
@@ -0,0 +1,64 @@
+//
+//  voxelizer.h
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+// Conservative voxelization of triangle meshes
+
+#pragma once
+
+#include <vector>
+
+#include "aabb.h"
+#include "triangle3.h"
+#include "vector3i.h"
+
+namespace hydra {
+
+class Arena;
+class Scheduler;
+
+class Voxelizer
+{
+public:
+  // Finds every cell of a grid covering bounds that overlaps at least one
+  // triangle, including cells that a triangle only touches.  Cells are
+  // appended to cells once each, ordered by z, then y, then x.  Geometry
+  // outside of bounds is ignored.  A threadCount of zero uses one thread per
+  // hardware thread.
+  static void Voxelize(const Triangle3* triangles, size_t count, const AABB& bounds, const Vector3i& resolution, unsigned int threadCount, std::vector<Vector3i>& cells);
+  static void Voxelize(const Triangle3* triangles, size_t count, const AABB& bounds, const Vector3i& resolution, Scheduler& scheduler, std::vector<Vector3i>& cells);
+  // As above, taking the per-triangle cell ranges and the slice buckets from
+  // scratch rather than the heap.  Only the calling thread allocates from
+  // scratch.
+  static void Voxelize(const Triangle3* triangles, size_t count, const AABB& bounds, const Vector3i& resolution, unsigned int threadCount, std::vector<Vector3i>& cells, Arena& scratch);
+  static void Voxelize(const Triangle3* triangles, size_t count, const AABB& bounds, const Vector3i& resolution, Scheduler& scheduler, std::vector<Vector3i>& cells, Arena& scratch);
+};
+
+} // namespace hydra
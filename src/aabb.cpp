@@ -41,28 +41,15 @@ void AABB::init()
   max = Vector3::Max();
 }
 
-AABB AABB::Create()
-{
-  AABB r;
-  r.init();
-  return r;
-}
-
 void AABB::init(const Vector3& minPoint, const Vector3& maxPoint)
 {
   min = minPoint;
   max = maxPoint;
 }
 
-AABB AABB::Create(const Vector3& minPoint, const Vector3& maxPoint)
-{
-  AABB r;
-  r.init(minPoint, maxPoint);
-  return r;
-}
-
 void AABB::init(const Vector3& corner1, const Vector3& corner2, const Matrix4& modelMatrix)
 {
+  HYDRA_PROFILE_SCOPE("AABB::init(transformed)");
   for (int iCorner = 0; iCorner < 8; iCorner++) {
     Vector3 sourceCornerVertex = Matrix4::DotWDiv(modelMatrix, Vector3::Create(
       (iCorner & 1) == 0 ? corner1.x : corner2.x,
@@ -91,32 +78,6 @@ AABB AABB::Create(const Vector3& corner1, const Vector3& corner2, const Matrix4&
   return r;
 }
 
-bool AABB::operator ==(const AABB& b) const
-{
-  return min == b.min && max == b.max;
-}
-
-bool AABB::operator !=(const AABB& b) const
-{
-  return min != b.min || max != b.max;
-}
-
-Vector3 AABB::center() const
-{
-  return (min + max) * 0.5f;
-}
-
-Vector3 AABB::size() const
-{
-  return max - min;
-}
-
-float AABB::volume() const
-{
-  Vector3 s = size();
-  return s.x * s.y * s.z;
-}
-
 void AABB::scale(const Vector3& s)
 {
   Vector3 prev_center = center();
@@ -162,33 +123,6 @@ bool AABB::operator <(const AABB& b) const
   }
 }
 
-bool AABB::intersects(const AABB& b) const
-{
-  // Return true if the two volumes intersect
-  return min.x <= b.max.x && min.y <= b.max.y && min.z <= b.max.z && max.x >= b.min.x && max.y >= b.min.y && max.z >= b.min.z;
-}
-
-bool AABB::contains(const AABB& b) const
-{
-  // Return true if the passed KRAABB is entirely contained within this KRAABB
-  return b.min.x >= min.x && b.min.y >= min.y && b.min.z >= min.z && b.max.x <= max.x && b.max.y <= max.y && b.max.z <= max.z;
-}
-
-bool AABB::contains(const Vector3& v) const
-{
-  return v.x >= min.x && v.x <= max.x && v.y >= min.y && v.y <= max.y && v.z >= min.z && v.z <= max.z;
-}
-
-AABB AABB::Infinite()
-{
-  return AABB::Create(Vector3::Min(), Vector3::Max());
-}
-
-AABB AABB::Zero()
-{
-  return AABB::Create(Vector3::Zero(), Vector3::Zero());
-}
-
 float AABB::longest_radius() const
 {
   float radius1 = (center() - min).magnitude();
@@ -199,6 +133,7 @@ float AABB::longest_radius() const
 
 bool AABB::intersectsLine(const Vector3& v1, const Vector3& v2) const
 {
+  HYDRA_PROFILE_SCOPE("AABB::intersectsLine");
   Vector3 dir = Vector3::Normalize(v2 - v1);
   float length = (v2 - v1).magnitude();
 
@@ -242,6 +177,7 @@ bool AABB::intersectsLine(const Vector3& v1, const Vector3& v2) const
 
 bool AABB::intersectsRay(const Vector3& v1, const Vector3& dir) const
 {
+  HYDRA_PROFILE_SCOPE("AABB::intersectsRay");
   /*
    Fast Ray-Box Intersection
    by Andrew Woo
@@ -321,6 +257,7 @@ bool AABB::intersectsRay(const Vector3& v1, const Vector3& dir) const
 
 bool AABB::intersectsSphere(const Vector3& center, float radius) const
 {
+  HYDRA_PROFILE_SCOPE("AABB::intersectsSphere");
   // Arvo's Algorithm
 
   float squaredDistance = 0;
@@ -0,0 +1,91 @@
+//
+//  aabbd.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+#include "krhelpers.h"
+
+namespace hydra {
+
+void AABBd::init()
+{
+  min = Vector3d::Min();
+  max = Vector3d::Max();
+}
+
+void AABBd::init(const Vector3d& minPoint, const Vector3d& maxPoint)
+{
+  min = minPoint;
+  max = maxPoint;
+}
+
+void AABBd::init(const AABB& b)
+{
+  min.init(b.min);
+  max.init(b.max);
+}
+
+void AABBd::init(const Vector3d& corner1, const Vector3d& corner2, const Matrix4d& modelMatrix)
+{
+  for (int iCorner = 0; iCorner < 8; iCorner++) {
+    Vector3d sourceCornerVertex = Matrix4d::DotWDiv(modelMatrix, Vector3d::Create(
+      (iCorner & 1) == 0 ? corner1.x : corner2.x,
+      (iCorner & 2) == 0 ? corner1.y : corner2.y,
+      (iCorner & 4) == 0 ? corner1.z : corner2.z));
+
+    if (iCorner == 0) {
+      min = sourceCornerVertex;
+      max = sourceCornerVertex;
+    } else {
+      min = Vector3d::Min(min, sourceCornerVertex);
+      max = Vector3d::Max(max, sourceCornerVertex);
+    }
+  }
+}
+
+AABBd AABBd::Create(const Vector3d& corner1, const Vector3d& corner2, const Matrix4d& modelMatrix)
+{
+  AABBd r;
+  r.init(corner1, corner2, modelMatrix);
+  return r;
+}
+
+void AABBd::encapsulate(const AABBd& b)
+{
+  min = Vector3d::Min(min, b.min);
+  max = Vector3d::Max(max, b.max);
+}
+
+Vector3d AABBd::nearestPoint(const Vector3d& v) const
+{
+  return Vector3d::Create(KRCLAMP(v.x, min.x, max.x), KRCLAMP(v.y, min.y, max.y), KRCLAMP(v.z, min.z, max.z));
+}
+
+} // namespace hydra
@@ -0,0 +1,512 @@
+//
+//  animationclip.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+#include "krhelpers.h"
+#include "assert.h"
+
+#include <algorithm>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace hydra {
+
+namespace {
+
+// Normalized linear interpolation along the shorter arc
+Quaternion _nlerp(const Quaternion& a, const Quaternion& b, float f)
+{
+#ifdef __SSE2__
+  __m128 va = _mm_loadu_ps(a.c);
+  __m128 vb = _mm_loadu_ps(b.c);
+  __m128 d = _mm_mul_ps(va, vb);
+  d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)));
+  d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(1, 0, 3, 2)));
+  // Flip b to the hemisphere of a by moving the sign of the dot product onto it
+  vb = _mm_xor_ps(vb, _mm_and_ps(d, _mm_set1_ps(-0.0f)));
+  __m128 r = _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(vb, va), _mm_set1_ps(f)));
+  __m128 l = _mm_mul_ps(r, r);
+  l = _mm_add_ps(l, _mm_shuffle_ps(l, l, _MM_SHUFFLE(2, 3, 0, 1)));
+  l = _mm_add_ps(l, _mm_shuffle_ps(l, l, _MM_SHUFFLE(1, 0, 3, 2)));
+  r = _mm_div_ps(r, _mm_sqrt_ps(l));
+  Quaternion q;
+  _mm_storeu_ps(q.c, r);
+  return q;
+#else
+  Quaternion bh = Quaternion::Dot(a, b) < 0.0f ? -b : b;
+  return Quaternion::Normalize(a + (bh - a) * f);
+#endif
+}
+
+float _distance(const Quaternion& a, const Quaternion& b)
+{
+  // q and -q are the same rotation
+  Quaternion d1 = a - b;
+  Quaternion d2 = a + b;
+  return sqrtf(KRMIN(Quaternion::Dot(d1, d1), Quaternion::Dot(d2, d2)));
+}
+
+Vector3 _interpolate(const Vector3& a, const Vector3& b, float f)
+{
+  return Vector3::Lerp(a, b, f);
+}
+
+Quaternion _interpolate(const Quaternion& a, const Quaternion& b, float f)
+{
+  return _nlerp(a, b, f);
+}
+
+float _distance(const Vector3& a, const Vector3& b)
+{
+  return (a - b).magnitude();
+}
+
+struct KeySpan
+{
+  size_t first;
+  size_t last;
+};
+
+// Ramer-Douglas-Peucker reduction over time: a span is kept as a single
+// segment if interpolating its end keys reproduces every key within it to
+// within tolerance, and is otherwise split at the worst key.  keep[i] is set
+// for each retained key.
+template<typename T>
+void _reduceKeys(const float* times, const T* values, size_t count, float tolerance, bool* keep, Arena& scratch)
+{
+  std::fill(keep, keep + count, false);
+  keep[0] = true;
+  keep[count - 1] = true;
+
+  // Spans on the stack share at most their end keys, so there are fewer
+  // of them than keys
+  KeySpan* spans = scratch.allocate<KeySpan>(count);
+  size_t spanCount = 0;
+  if (count > 2) {
+    spans[spanCount].first = 0;
+    spans[spanCount].last = count - 1;
+    spanCount++;
+  }
+  while (spanCount > 0) {
+    spanCount--;
+    size_t first = spans[spanCount].first;
+    size_t last = spans[spanCount].last;
+
+    float worstError = tolerance;
+    size_t worst = 0;
+    for (size_t i = first + 1; i < last; i++) {
+      float f = (times[i] - times[first]) / (times[last] - times[first]);
+      float error = _distance(_interpolate(values[first], values[last], f), values[i]);
+      if (error > worstError) {
+        worstError = error;
+        worst = i;
+      }
+    }
+    if (worst != 0) {
+      keep[worst] = true;
+      if (worst - first > 1) {
+        spans[spanCount].first = first;
+        spans[spanCount].last = worst;
+        spanCount++;
+      }
+      if (last - worst > 1) {
+        spans[spanCount].first = worst;
+        spans[spanCount].last = last;
+        spanCount++;
+      }
+    }
+  }
+}
+
+// Returns the first key of the pair bracketing t and the interpolation
+// factor between them
+size_t _findKey(const float* times, size_t count, float t, float& f)
+{
+  const float* upper = std::upper_bound(times, times + count, t);
+  if (upper == times) {
+    f = 0.0f;
+    return 0;
+  }
+  if (upper == times + count) {
+    f = 0.0f;
+    return count - 1;
+  }
+  size_t k = upper - times - 1;
+  f = (t - times[k]) / (times[k + 1] - times[k]);
+  return k;
+}
+
+// Tracks are sampled in groups of SAMPLE_LANES, laid out as structures of
+// arrays so that decoding and interpolation cover a whole group per
+// instruction
+const size_t SAMPLE_LANES = 4;
+const float SAMPLE_INV_SQRT2 = 1.0f / 1.41421356f;
+
+// Locates the pair of keys bracketing t for each track of a group.  kb is ka
+// where f is zero, so that it is always a valid key.  Lanes past count
+// repeat the last track and are not stored.
+void _findKeys(const AnimationTrack* tracks, size_t count, const float* times, float t, size_t* ka, size_t* kb, float* f)
+{
+  for (size_t i = 0; i < SAMPLE_LANES; i++) {
+    const AnimationTrack& tr = tracks[KRMIN(i, count - 1)];
+    ka[i] = tr.firstKey + _findKey(&times[tr.firstKey], tr.keyCount, t, f[i]);
+    kb[i] = f[i] > 0.0f ? ka[i] + 1 : ka[i];
+  }
+}
+
+void _sampleVector3Group(const AnimationTrack* tracks, size_t count, const float* times, const Vector3s* keys, float t, Vector3* out)
+{
+  size_t ka[SAMPLE_LANES];
+  size_t kb[SAMPLE_LANES];
+  float f[SAMPLE_LANES];
+  _findKeys(tracks, count, times, t, ka, kb, f);
+
+  // Indexed by component, then lane
+  int32_t a[3][SAMPLE_LANES];
+  int32_t b[3][SAMPLE_LANES];
+  float center[3][SAMPLE_LANES];
+  float extent[3][SAMPLE_LANES];
+  float r[3][SAMPLE_LANES];
+  for (size_t i = 0; i < SAMPLE_LANES; i++) {
+    const AnimationTrack& tr = tracks[KRMIN(i, count - 1)];
+    const Vector3s& ai = keys[ka[i]];
+    const Vector3s& bi = keys[kb[i]];
+    a[0][i] = ai.x;
+    a[1][i] = ai.y;
+    a[2][i] = ai.z;
+    b[0][i] = bi.x;
+    b[1][i] = bi.y;
+    b[2][i] = bi.z;
+    for (int j = 0; j < 3; j++) {
+      center[j][i] = tr.center.c[j];
+      extent[j][i] = tr.extent.c[j];
+    }
+  }
+
+#ifdef __SSE2__
+  __m128 vf = _mm_loadu_ps(f);
+  __m128 scale = _mm_set1_ps(1.0f / 32767.0f);
+  __m128 minusOne = _mm_set1_ps(-1.0f);
+  for (int j = 0; j < 3; j++) {
+    __m128 va = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)a[j])), scale), minusOne);
+    __m128 vb = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)b[j])), scale), minusOne);
+    __m128 v = _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(vb, va), vf));
+    _mm_storeu_ps(r[j], _mm_add_ps(_mm_loadu_ps(center[j]), _mm_mul_ps(v, _mm_loadu_ps(extent[j]))));
+  }
+#else
+  for (int j = 0; j < 3; j++) {
+    for (size_t i = 0; i < SAMPLE_LANES; i++) {
+      float va = Snorm16ToFloat((int16_t)a[j][i]);
+      float vb = Snorm16ToFloat((int16_t)b[j][i]);
+      r[j][i] = center[j][i] + (va + (vb - va) * f[i]) * extent[j][i];
+    }
+  }
+#endif
+
+  for (size_t i = 0; i < count; i++) {
+    out[i] = Vector3::Create(r[0][i], r[1][i], r[2][i]);
+  }
+}
+
+void _sampleQuaternionGroup(const AnimationTrack* tracks, size_t count, const float* times, const PackedQuaternion48* keys, float t, Quaternion* out)
+{
+  size_t ka[SAMPLE_LANES];
+  size_t kb[SAMPLE_LANES];
+  float f[SAMPLE_LANES];
+  _findKeys(tracks, count, times, t, ka, kb, f);
+
+  // Each key is the index of its dropped component and three 15 bit
+  // components; indexed by key, then component, then lane
+  const size_t* k[2] = { ka, kb };
+  int32_t largest[2][SAMPLE_LANES];
+  int32_t v[2][3][SAMPLE_LANES];
+  for (int j = 0; j < 2; j++) {
+    for (size_t i = 0; i < SAMPLE_LANES; i++) {
+      const uint16_t* c = keys[k[j][i]].c;
+      uint64_t bits = ((uint64_t)c[0] << 32) | ((uint64_t)c[1] << 16) | (uint64_t)c[2];
+      largest[j][i] = (int32_t)(bits >> 45) & 3;
+      v[j][0][i] = (int32_t)(bits >> 30) & 0x7fff;
+      v[j][1][i] = (int32_t)(bits >> 15) & 0x7fff;
+      v[j][2][i] = (int32_t)bits & 0x7fff;
+    }
+  }
+
+#ifdef __SSE2__
+  __m128 scale = _mm_set1_ps(1.0f / 32767.0f);
+  __m128 one = _mm_set1_ps(1.0f);
+  __m128 two = _mm_set1_ps(2.0f);
+  __m128 invSqrt2 = _mm_set1_ps(SAMPLE_INV_SQRT2);
+  __m128 zero = _mm_setzero_ps();
+  // Decoded components of each key, as x, y, z, w over the lanes
+  __m128 q[2][4];
+  for (int j = 0; j < 2; j++) {
+    __m128 c[3];
+    __m128 sum = zero;
+    for (int n = 0; n < 3; n++) {
+      __m128 x = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)v[j][n]));
+      c[n] = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(x, scale), two), one), invSqrt2);
+      sum = _mm_add_ps(sum, _mm_mul_ps(c[n], c[n]));
+    }
+    __m128 w = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(one, sum), zero));
+    // The stored components fill the slots around the dropped one
+    __m128i l = _mm_loadu_si128((const __m128i*)largest[j]);
+    __m128 is0 = _mm_castsi128_ps(_mm_cmpeq_epi32(l, _mm_set1_epi32(0)));
+    __m128 is1 = _mm_castsi128_ps(_mm_cmpeq_epi32(l, _mm_set1_epi32(1)));
+    __m128 is2 = _mm_castsi128_ps(_mm_cmpeq_epi32(l, _mm_set1_epi32(2)));
+    __m128 is3 = _mm_castsi128_ps(_mm_cmpeq_epi32(l, _mm_set1_epi32(3)));
+    __m128 below1 = _mm_or_ps(is0, is1);
+    q[j][0] = _mm_or_ps(_mm_and_ps(is0, w), _mm_andnot_ps(is0, c[0]));
+    q[j][1] = _mm_or_ps(_mm_and_ps(is0, c[0]), _mm_or_ps(_mm_and_ps(is1, w), _mm_andnot_ps(below1, c[1])));
+    q[j][2] = _mm_or_ps(_mm_and_ps(below1, c[1]), _mm_or_ps(_mm_and_ps(is2, w), _mm_and_ps(is3, c[2])));
+    q[j][3] = _mm_or_ps(_mm_and_ps(is3, w), _mm_andnot_ps(is3, c[2]));
+  }
+
+  // Normalized linear interpolation along the shorter arc, as in _nlerp
+  __m128 vf = _mm_loadu_ps(f);
+  __m128 d = _mm_add_ps(
+    _mm_add_ps(_mm_mul_ps(q[0][0], q[1][0]), _mm_mul_ps(q[0][1], q[1][1])),
+    _mm_add_ps(_mm_mul_ps(q[0][2], q[1][2]), _mm_mul_ps(q[0][3], q[1][3])));
+  __m128 flip = _mm_and_ps(d, _mm_set1_ps(-0.0f));
+  __m128 r[4];
+  for (int n = 0; n < 4; n++) {
+    __m128 b = _mm_xor_ps(q[1][n], flip);
+    r[n] = _mm_add_ps(q[0][n], _mm_mul_ps(_mm_sub_ps(b, q[0][n]), vf));
+  }
+  __m128 len = _mm_sqrt_ps(_mm_add_ps(
+    _mm_add_ps(_mm_mul_ps(r[0], r[0]), _mm_mul_ps(r[1], r[1])),
+    _mm_add_ps(_mm_mul_ps(r[2], r[2]), _mm_mul_ps(r[3], r[3]))));
+  // Keys that are not interpolated are returned as decoded
+  __m128 interpolate = _mm_cmpgt_ps(vf, zero);
+  for (int n = 0; n < 4; n++) {
+    r[n] = _mm_or_ps(_mm_and_ps(interpolate, _mm_div_ps(r[n], len)), _mm_andnot_ps(interpolate, q[0][n]));
+  }
+  _MM_TRANSPOSE4_PS(r[0], r[1], r[2], r[3]);
+  for (size_t i = 0; i < count; i++) {
+    _mm_storeu_ps(out[i].c, r[i]);
+  }
+#else
+  for (size_t i = 0; i < count; i++) {
+    Quaternion q[2];
+    for (int j = 0; j < 2; j++) {
+      float sum = 0.0f;
+      int n = 0;
+      for (int m = 0; m < 4; m++) {
+        if (m == largest[j][i]) {
+          continue;
+        }
+        float c = ((float)v[j][n][i] * (1.0f / 32767.0f) * 2.0f - 1.0f) * SAMPLE_INV_SQRT2;
+        q[j].c[m] = c;
+        sum += c * c;
+        n++;
+      }
+      float w = 1.0f - sum;
+      q[j].c[largest[j][i]] = w > 0.0f ? sqrtf(w) : 0.0f;
+    }
+    out[i] = f[i] > 0.0f ? _nlerp(q[0], q[1], f[i]) : q[0];
+  }
+#endif
+}
+
+} // anonymous namespace
+
+AnimationClip::AnimationClip()
+  : m_duration(0.0f)
+{
+
+}
+
+AnimationClip::~AnimationClip()
+{
+
+}
+
+int AnimationClip::addTrack(const float* times, const Vector3* values, size_t count, float tolerance)
+{
+  Arena scratch;
+  return addTrack(times, values, count, tolerance, scratch);
+}
+
+int AnimationClip::addTrack(const float* times, const Vector3* values, size_t count, float tolerance, Arena& scratch)
+{
+  HYDRA_PROFILE_SCOPE("AnimationClip::addTrack");
+  assert(count > 0);
+  for (size_t i = 1; i < count; i++) {
+    assert(times[i] > times[i - 1]);
+  }
+
+  bool* keep = scratch.allocate<bool>(count);
+  _reduceKeys(times, values, count, tolerance, keep, scratch);
+
+  Vector3 minValue = values[0];
+  Vector3 maxValue = values[0];
+  for (size_t i = 1; i < count; i++) {
+    if (keep[i]) {
+      minValue = Vector3::Min(minValue, values[i]);
+      maxValue = Vector3::Max(maxValue, values[i]);
+    }
+  }
+
+  AnimationTrack track;
+  track.firstKey = (uint32_t)m_vector3Times.size();
+  track.keyCount = 0;
+  track.center = (minValue + maxValue) * 0.5f;
+  track.extent = (maxValue - minValue) * 0.5f;
+  // Constant components decode exactly from center alone
+  Vector3 invExtent = Vector3::Create(
+    track.extent.x > 0.0f ? 1.0f / track.extent.x : 0.0f,
+    track.extent.y > 0.0f ? 1.0f / track.extent.y : 0.0f,
+    track.extent.z > 0.0f ? 1.0f / track.extent.z : 0.0f);
+
+  for (size_t i = 0; i < count; i++) {
+    if (keep[i]) {
+      m_vector3Times.push_back(times[i]);
+      m_vector3Keys.push_back(Vector3s::Create(Vector3::Scale(values[i] - track.center, invExtent)));
+      track.keyCount++;
+    }
+  }
+  m_vector3Tracks.push_back(track);
+  m_duration = KRMAX(m_duration, times[count - 1]);
+  return (int)m_vector3Tracks.size() - 1;
+}
+
+int AnimationClip::addTrack(const float* times, const Quaternion* values, size_t count, float tolerance)
+{
+  Arena scratch;
+  return addTrack(times, values, count, tolerance, scratch);
+}
+
+int AnimationClip::addTrack(const float* times, const Quaternion* values, size_t count, float tolerance, Arena& scratch)
+{
+  HYDRA_PROFILE_SCOPE("AnimationClip::addTrack");
+  assert(count > 0);
+  for (size_t i = 1; i < count; i++) {
+    assert(times[i] > times[i - 1]);
+  }
+
+  bool* keep = scratch.allocate<bool>(count);
+  _reduceKeys(times, values, count, tolerance, keep, scratch);
+
+  AnimationTrack track;
+  track.firstKey = (uint32_t)m_quaternionTimes.size();
+  track.keyCount = 0;
+  track.center = Vector3::Zero();
+  track.extent = Vector3::Zero();
+
+  for (size_t i = 0; i < count; i++) {
+    if (keep[i]) {
+      m_quaternionTimes.push_back(times[i]);
+      m_quaternionKeys.push_back(PackedQuaternion48::Create(values[i]));
+      track.keyCount++;
+    }
+  }
+  m_quaternionTracks.push_back(track);
+  m_duration = KRMAX(m_duration, times[count - 1]);
+  return (int)m_quaternionTracks.size() - 1;
+}
+
+void AnimationClip::clear()
+{
+  m_vector3Tracks.clear();
+  m_quaternionTracks.clear();
+  m_vector3Times.clear();
+  m_quaternionTimes.clear();
+  m_vector3Keys.clear();
+  m_quaternionKeys.clear();
+  m_duration = 0.0f;
+}
+
+int AnimationClip::vector3TrackCount() const
+{
+  return (int)m_vector3Tracks.size();
+}
+
+int AnimationClip::quaternionTrackCount() const
+{
+  return (int)m_quaternionTracks.size();
+}
+
+size_t AnimationClip::keyCount() const
+{
+  return m_vector3Keys.size() + m_quaternionKeys.size();
+}
+
+float AnimationClip::duration() const
+{
+  return m_duration;
+}
+
+Vector3 AnimationClip::sampleVector3(int track, float t) const
+{
+  HYDRA_PROFILE_SCOPE("AnimationClip::sampleVector3");
+  const AnimationTrack& tr = m_vector3Tracks[track];
+  float f;
+  size_t k = tr.firstKey + _findKey(&m_vector3Times[tr.firstKey], tr.keyCount, t, f);
+  Vector3 a = m_vector3Keys[k].asVector3();
+  Vector3 v = a;
+  if (f > 0.0f) {
+    v = Vector3::Lerp(a, m_vector3Keys[k + 1].asVector3(), f);
+  }
+  return tr.center + Vector3::Scale(v, tr.extent);
+}
+
+Quaternion AnimationClip::sampleQuaternion(int track, float t) const
+{
+  HYDRA_PROFILE_SCOPE("AnimationClip::sampleQuaternion");
+  const AnimationTrack& tr = m_quaternionTracks[track];
+  float f;
+  size_t k = tr.firstKey + _findKey(&m_quaternionTimes[tr.firstKey], tr.keyCount, t, f);
+  Quaternion a = m_quaternionKeys[k].asQuaternion();
+  if (f > 0.0f) {
+    return _nlerp(a, m_quaternionKeys[k + 1].asQuaternion(), f);
+  }
+  return a;
+}
+
+void AnimationClip::sample(float t, Vector3* vectors, Quaternion* rotations) const
+{
+  HYDRA_PROFILE_SCOPE("AnimationClip::sample");
+  // Tracks, times and keys are each stored contiguously in track order, so
+  // a full evaluation walks every array forwards once.  The clip holds no
+  // cursor, so that it can be sampled from several threads; each track does
+  // one binary search over its own keys.
+  size_t vectorCount = m_vector3Tracks.size();
+  for (size_t i = 0; i < vectorCount; i += SAMPLE_LANES) {
+    _sampleVector3Group(&m_vector3Tracks[i], KRMIN(SAMPLE_LANES, vectorCount - i), m_vector3Times.data(), m_vector3Keys.data(), t, vectors + i);
+  }
+  size_t rotationCount = m_quaternionTracks.size();
+  for (size_t i = 0; i < rotationCount; i += SAMPLE_LANES) {
+    _sampleQuaternionGroup(&m_quaternionTracks[i], KRMIN(SAMPLE_LANES, rotationCount - i), m_quaternionTimes.data(), m_quaternionKeys.data(), t, rotations + i);
+  }
+}
+
+} // namespace hydra
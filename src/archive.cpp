@@ -0,0 +1,415 @@
+//
+//  archive.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hydra {
+
+namespace {
+
+const char MAGIC[4] = { 'H', 'Y', 'D', 'A' };
+
+size_t _align(size_t offset)
+{
+  return (offset + Archive::ALIGNMENT - 1) & ~(Archive::ALIGNMENT - 1);
+}
+
+// Hashes the header, with its checksum field zeroed, followed by the rest of
+// the archive
+uint64_t _checksum(const uint8_t* archive, size_t size)
+{
+  ArchiveHeader header;
+  memcpy(&header, archive, sizeof(header));
+  header.checksum = 0;
+  uint64_t seed = Hash::Bytes(&header, sizeof(header), 0);
+  return Hash::Bytes(archive + sizeof(ArchiveHeader), size - sizeof(ArchiveHeader), seed);
+}
+
+} // anonymous namespace
+
+Archive::Archive()
+  : m_data(nullptr)
+  , m_size(0)
+  , m_mapping(nullptr)
+  , m_mappingSize(0)
+{
+
+}
+
+Archive::~Archive()
+{
+  close();
+}
+
+bool Archive::open(const char* path)
+{
+  HYDRA_PROFILE_SCOPE("Archive::open");
+  close();
+#ifdef _WIN32
+  HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0 || (uint64_t)fileSize.QuadPart > (uint64_t)SIZE_MAX) {
+    CloseHandle(file);
+    return false;
+  }
+  size_t size = (size_t)fileSize.QuadPart;
+  HANDLE mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (mappingHandle == nullptr) {
+    return false;
+  }
+  // The view keeps the mapping object and the file referenced
+  void* mapping = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, size);
+  CloseHandle(mappingHandle);
+  if (mapping == nullptr) {
+    return false;
+  }
+  if (!open(mapping, size)) {
+    UnmapViewOfFile(mapping);
+    return false;
+  }
+  m_mapping = mapping;
+  m_mappingSize = size;
+  return true;
+#else
+  int fd = ::open(path, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    ::close(fd);
+    return false;
+  }
+  void* mapping = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  // The mapping keeps the file referenced
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+  if (!open(mapping, (size_t)st.st_size)) {
+    munmap(mapping, (size_t)st.st_size);
+    return false;
+  }
+  m_mapping = mapping;
+  m_mappingSize = (size_t)st.st_size;
+  return true;
+#endif
+}
+
+bool Archive::open(const void* data, size_t size)
+{
+  HYDRA_PROFILE_SCOPE("Archive::open");
+  close();
+  if (data == nullptr || ((uintptr_t)data & 7) != 0 || size < sizeof(ArchiveHeader)) {
+    return false;
+  }
+  const ArchiveHeader* header = (const ArchiveHeader*)data;
+  if (memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0
+    || header->endianTag != ENDIAN_TAG
+    || header->version != VERSION
+    || header->size > size
+    || header->size < sizeof(ArchiveHeader)) {
+    return false;
+  }
+  size = (size_t)header->size;
+  if (header->chunkCount > (size - sizeof(ArchiveHeader)) / sizeof(ArchiveChunk)) {
+    return false;
+  }
+  // Chunk data may not overlap the header or the chunk table
+  size_t tableEnd = sizeof(ArchiveHeader) + (size_t)header->chunkCount * sizeof(ArchiveChunk);
+  const ArchiveChunk* chunks = (const ArchiveChunk*)(header + 1);
+  for (uint32_t i = 0; i < header->chunkCount; i++) {
+    const ArchiveChunk& chunk = chunks[i];
+    if (chunk.offset % ALIGNMENT != 0 || chunk.offset < tableEnd || chunk.offset > size) {
+      return false;
+    }
+    if (chunk.elementSize == 0) {
+      if (chunk.count != 0) {
+        return false;
+      }
+    } else if (chunk.count > (size - chunk.offset) / chunk.elementSize) {
+      return false;
+    }
+  }
+  m_data = (const uint8_t*)data;
+  m_size = size;
+  return true;
+}
+
+void Archive::close()
+{
+  if (m_mapping != nullptr) {
+#ifdef _WIN32
+    UnmapViewOfFile(m_mapping);
+#else
+    munmap(m_mapping, m_mappingSize);
+#endif
+  }
+  m_mapping = nullptr;
+  m_mappingSize = 0;
+  m_data = nullptr;
+  m_size = 0;
+}
+
+bool Archive::isOpen() const
+{
+  return m_data != nullptr;
+}
+
+bool Archive::verify() const
+{
+  HYDRA_PROFILE_SCOPE("Archive::verify");
+  if (m_data == nullptr) {
+    return false;
+  }
+  return _checksum(m_data, m_size) == getHeader().checksum;
+}
+
+const ArchiveHeader& Archive::getHeader() const
+{
+  return *(const ArchiveHeader*)m_data;
+}
+
+size_t Archive::chunkCount() const
+{
+  return m_data == nullptr ? 0 : getHeader().chunkCount;
+}
+
+const ArchiveChunk& Archive::getChunk(size_t index) const
+{
+  return ((const ArchiveChunk*)(m_data + sizeof(ArchiveHeader)))[index];
+}
+
+const ArchiveChunk* Archive::findChunk(uint32_t id) const
+{
+  size_t count = chunkCount();
+  for (size_t i = 0; i < count; i++) {
+    if (getChunk(i).id == id) {
+      return &getChunk(i);
+    }
+  }
+  return nullptr;
+}
+
+bool Archive::get(uint32_t id, ArchiveType type, size_t elementSize, const void*& data, size_t& count) const
+{
+  const ArchiveChunk* chunk = findChunk(id);
+  if (chunk == nullptr || chunk->type != type || chunk->elementSize != elementSize) {
+    return false;
+  }
+  data = m_data + chunk->offset;
+  count = (size_t)chunk->count;
+  return true;
+}
+
+bool Archive::get(uint32_t id, const void*& data, size_t& length) const
+{
+  return get(id, ArchiveType::BYTES, 1, data, length);
+}
+
+bool Archive::get(uint32_t id, const uint32_t*& data, size_t& count) const
+{
+  const void* p;
+  if (!get(id, ArchiveType::UINT32, sizeof(uint32_t), p, count)) {
+    return false;
+  }
+  data = (const uint32_t*)p;
+  return true;
+}
+
+bool Archive::get(uint32_t id, const Vector3*& data, size_t& count) const
+{
+  const void* p;
+  if (!get(id, ArchiveType::VECTOR3, sizeof(Vector3), p, count)) {
+    return false;
+  }
+  data = (const Vector3*)p;
+  return true;
+}
+
+bool Archive::get(uint32_t id, const Matrix4*& data, size_t& count) const
+{
+  const void* p;
+  if (!get(id, ArchiveType::MATRIX4, sizeof(Matrix4), p, count)) {
+    return false;
+  }
+  data = (const Matrix4*)p;
+  return true;
+}
+
+bool Archive::get(uint32_t id, const AABB*& data, size_t& count) const
+{
+  const void* p;
+  if (!get(id, ArchiveType::AABB, sizeof(AABB), p, count)) {
+    return false;
+  }
+  data = (const AABB*)p;
+  return true;
+}
+
+bool Archive::get(uint32_t id, const Triangle3*& data, size_t& count) const
+{
+  const void* p;
+  if (!get(id, ArchiveType::TRIANGLE3, sizeof(Triangle3), p, count)) {
+    return false;
+  }
+  data = (const Triangle3*)p;
+  return true;
+}
+
+ArchiveWriter::ArchiveWriter()
+{
+
+}
+
+ArchiveWriter::~ArchiveWriter()
+{
+
+}
+
+void ArchiveWriter::add(uint32_t id, ArchiveType type, const void* data, size_t elementSize, size_t count)
+{
+  ArchiveChunk chunk;
+  chunk.id = id;
+  chunk.type = type;
+  chunk.elementSize = (uint32_t)elementSize;
+  chunk.reserved = 0;
+  chunk.offset = m_data.size();
+  chunk.count = count;
+  m_chunks.push_back(chunk);
+
+  size_t length = elementSize * count;
+  m_data.resize(_align(m_data.size() + length), 0);
+  if (length > 0) {
+    memcpy(&m_data[(size_t)chunk.offset], data, length);
+  }
+}
+
+void ArchiveWriter::add(uint32_t id, const void* data, size_t length)
+{
+  add(id, ArchiveType::BYTES, data, 1, length);
+}
+
+void ArchiveWriter::add(uint32_t id, const uint32_t* data, size_t count)
+{
+  add(id, ArchiveType::UINT32, data, sizeof(uint32_t), count);
+}
+
+void ArchiveWriter::add(uint32_t id, const Vector3* data, size_t count)
+{
+  add(id, ArchiveType::VECTOR3, data, sizeof(Vector3), count);
+}
+
+void ArchiveWriter::add(uint32_t id, const Matrix4* data, size_t count)
+{
+  add(id, ArchiveType::MATRIX4, data, sizeof(Matrix4), count);
+}
+
+void ArchiveWriter::add(uint32_t id, const AABB* data, size_t count)
+{
+  add(id, ArchiveType::AABB, data, sizeof(AABB), count);
+}
+
+void ArchiveWriter::add(uint32_t id, const Triangle3* data, size_t count)
+{
+  add(id, ArchiveType::TRIANGLE3, data, sizeof(Triangle3), count);
+}
+
+void ArchiveWriter::clear()
+{
+  m_chunks.clear();
+  m_data.clear();
+}
+
+size_t ArchiveWriter::size() const
+{
+  return _align(sizeof(ArchiveHeader) + m_chunks.size() * sizeof(ArchiveChunk)) + m_data.size();
+}
+
+void ArchiveWriter::write(std::vector<uint8_t>& archive) const
+{
+  HYDRA_PROFILE_SCOPE("ArchiveWriter::write");
+  size_t dataOffset = _align(sizeof(ArchiveHeader) + m_chunks.size() * sizeof(ArchiveChunk));
+  archive.assign(dataOffset + m_data.size(), 0);
+
+  ArchiveChunk* chunks = (ArchiveChunk*)&archive[sizeof(ArchiveHeader)];
+  for (size_t i = 0; i < m_chunks.size(); i++) {
+    chunks[i] = m_chunks[i];
+    chunks[i].offset += dataOffset;
+  }
+  if (!m_data.empty()) {
+    memcpy(&archive[dataOffset], m_data.data(), m_data.size());
+  }
+
+  ArchiveHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.endianTag = Archive::ENDIAN_TAG;
+  header.version = Archive::VERSION;
+  header.chunkCount = (uint32_t)m_chunks.size();
+  header.size = archive.size();
+  memcpy(&archive[0], &header, sizeof(header));
+  header.checksum = _checksum(&archive[0], archive.size());
+  memcpy(&archive[0], &header, sizeof(header));
+}
+
+bool ArchiveWriter::write(const char* path) const
+{
+  std::vector<uint8_t> archive;
+  write(archive);
+  FILE* file = fopen(path, "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  bool written = fwrite(archive.data(), 1, archive.size(), file) == archive.size();
+  return fclose(file) == 0 && written;
+}
+
+} // namespace hydra
@@ -0,0 +1,143 @@
+//
+//  arena.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+#include "assert.h"
+#include "krhelpers.h"
+
+#include <new> // for bad_alloc
+
+namespace hydra {
+
+namespace {
+
+// Blocks are aligned for any SIMD type in the library, so that allocations
+// with up to this alignment never need padding at the start of a block
+const size_t ARENA_BLOCK_ALIGNMENT = 64;
+
+// Returns the first offset at or after offset whose address is aligned
+size_t _alignOffset(const uint8_t* base, size_t offset, size_t alignment)
+{
+  uintptr_t address = (uintptr_t)(base + offset);
+  return offset + (size_t)((alignment - (address & (alignment - 1))) & (alignment - 1));
+}
+
+} // anonymous namespace
+
+Arena::Arena()
+  : m_blockSize(DEFAULT_BLOCK_SIZE)
+  , m_block(0)
+  , m_offset(0)
+  , m_used(0)
+{
+
+}
+
+Arena::Arena(size_t blockSize)
+  : m_blockSize(blockSize > 0 ? blockSize : DEFAULT_BLOCK_SIZE)
+  , m_block(0)
+  , m_offset(0)
+  , m_used(0)
+{
+
+}
+
+Arena::~Arena()
+{
+  release();
+}
+
+void* Arena::allocate(size_t size, size_t alignment)
+{
+  assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+  if (size == 0) {
+    size = 1;
+  }
+
+  // Try the current block, then move on to the following blocks, which are
+  // only present after a reset
+  while (m_block < m_blocks.size()) {
+    const Block& block = m_blocks[m_block];
+    size_t start = _alignOffset(block.data, m_offset, alignment);
+    if (start + size <= block.size) {
+      m_offset = start + size;
+      return block.data + start;
+    }
+    m_used += block.size;
+    m_block++;
+    m_offset = 0;
+  }
+
+  size_t blockSize = KRMAX(m_blockSize, size + (alignment > ARENA_BLOCK_ALIGNMENT ? alignment : 0));
+  Block block;
+  block.data = (uint8_t*)AlignedAlloc(blockSize, ARENA_BLOCK_ALIGNMENT);
+  if (block.data == nullptr) {
+    throw std::bad_alloc();
+  }
+  block.size = blockSize;
+  m_blocks.push_back(block);
+  m_block = m_blocks.size() - 1;
+  size_t start = _alignOffset(block.data, 0, alignment);
+  m_offset = start + size;
+  return block.data + start;
+}
+
+void Arena::reset()
+{
+  m_block = 0;
+  m_offset = 0;
+  m_used = 0;
+}
+
+void Arena::release()
+{
+  for (size_t i = 0; i < m_blocks.size(); i++) {
+    AlignedFree(m_blocks[i].data);
+  }
+  m_blocks.clear();
+  reset();
+}
+
+size_t Arena::used() const
+{
+  return m_used + m_offset;
+}
+
+size_t Arena::capacity() const
+{
+  size_t total = 0;
+  for (size_t i = 0; i < m_blocks.size(); i++) {
+    total += m_blocks[i].size;
+  }
+  return total;
+}
+
+} // namespace hydra
@@ -0,0 +1,1571 @@
+//
+//  bvh.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+#include "assert.h"
+#include "krhelpers.h"
+
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace hydra {
+
+namespace {
+
+const int BVH_BIN_COUNT = 16;
+const int BVH_MAX_LEAF_SIZE = 4;
+const int BVH_MAX_DEPTH = 64;
+const uint32_t BVH_NO_HIT = 0xffffffff;
+const size_t BVH_PACKETS_PER_TASK = 8; // Grain of batch ray casts spread over a Scheduler
+
+const uint32_t BVH_BLOB_MAGIC = 0x48564248; // "HBVH"
+const uint32_t BVH_BLOB_VERSION = 2;
+
+// Offsets are from the start of the blob
+struct BlobHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t endianTag;
+  uint32_t nodeSize;
+  uint64_t size;
+  uint64_t checksum; // Hash::Bytes of the header, with this field zeroed, and everything following it
+  uint64_t nodeCount;
+  uint64_t triangleCount;
+  uint64_t nodeOffset;
+  uint64_t triangleOffset;
+  uint64_t triangleIndexOffset;
+  uint64_t planeOffset;
+};
+
+struct BuildPrimitive
+{
+  AABB bounds;
+  Vector3 centroid;
+  uint32_t index;
+};
+
+struct BuildBin
+{
+  AABB bounds;
+  int count;
+};
+
+AABB _triangleBounds(const Triangle3& tri)
+{
+  return AABB::Create(Vector3::Min(Vector3::Min(tri[0], tri[1]), tri[2]),
+                      Vector3::Max(Vector3::Max(tri[0], tri[1]), tri[2]));
+}
+
+float _surfaceArea(const AABB& b)
+{
+  Vector3 s = b.size();
+  return 2.0f * (s.x * s.y + s.y * s.z + s.z * s.x);
+}
+
+AABB _emptyBounds()
+{
+  // Inverted bounds, so that the first encapsulate() call replaces them
+  return AABB::Create(Vector3::Max(), Vector3::Min());
+}
+
+void _growBounds(AABB& bounds, const Vector3& v)
+{
+  bounds.min = Vector3::Min(bounds.min, v);
+  bounds.max = Vector3::Max(bounds.max, v);
+}
+
+// Levels of median splits needed before count primitives fit in a leaf
+int _medianSplitDepth(size_t count)
+{
+  int depth = 0;
+  while (count > 0xffff) {
+    count -= count / 2;
+    depth++;
+  }
+  return depth;
+}
+
+void _buildNode(std::vector<BVHNode>& nodes, BuildPrimitive* prims, size_t begin, size_t end, int depth)
+{
+  assert(depth < BVH_MAX_DEPTH);
+  size_t nodeIndex = nodes.size();
+  nodes.push_back(BVHNode());
+
+  AABB bounds = _emptyBounds();
+  AABB centroidBounds = _emptyBounds();
+  for (size_t i = begin; i < end; i++) {
+    bounds.encapsulate(prims[i].bounds);
+    _growBounds(centroidBounds, prims[i].centroid);
+  }
+
+  size_t count = end - begin;
+  nodes[nodeIndex].bounds = bounds;
+  nodes[nodeIndex].axis = 0;
+
+  // Choose the split with the lowest surface area heuristic cost, evaluating
+  // BVH_BIN_COUNT candidate planes along each axis.  Enough levels are held
+  // back for the median splits below to finish ranges too large for a leaf,
+  // so no node is deeper than the traversal stacks allow.
+  int bestAxis = -1;
+  int bestBin = 0;
+  float bestCost = (float)count;
+  Vector3 centroidExtent = centroidBounds.size();
+  if (count > BVH_MAX_LEAF_SIZE && depth + _medianSplitDepth(count) < BVH_MAX_DEPTH - 1) {
+    float parentArea = _surfaceArea(bounds);
+    for (int axis = 0; axis < 3; axis++) {
+      if (centroidExtent[axis] <= 0.0f) {
+        continue;
+      }
+      BuildBin bins[BVH_BIN_COUNT];
+      for (int b = 0; b < BVH_BIN_COUNT; b++) {
+        bins[b].bounds = _emptyBounds();
+        bins[b].count = 0;
+      }
+      float binScale = BVH_BIN_COUNT / centroidExtent[axis];
+      for (size_t i = begin; i < end; i++) {
+        int b = (int)((prims[i].centroid[axis] - centroidBounds.min[axis]) * binScale);
+        b = KRCLAMP(b, 0, BVH_BIN_COUNT - 1);
+        bins[b].bounds.encapsulate(prims[i].bounds);
+        bins[b].count++;
+      }
+
+      // Sweep from the right to accumulate the cost of each right partition
+      float rightArea[BVH_BIN_COUNT];
+      int rightCount[BVH_BIN_COUNT];
+      AABB accum = _emptyBounds();
+      int accumCount = 0;
+      for (int b = BVH_BIN_COUNT - 1; b > 0; b--) {
+        accum.encapsulate(bins[b].bounds);
+        accumCount += bins[b].count;
+        rightArea[b] = accumCount ? _surfaceArea(accum) : 0.0f;
+        rightCount[b] = accumCount;
+      }
+
+      accum = _emptyBounds();
+      accumCount = 0;
+      for (int b = 0; b < BVH_BIN_COUNT - 1; b++) {
+        accum.encapsulate(bins[b].bounds);
+        accumCount += bins[b].count;
+        if (accumCount == 0 || rightCount[b + 1] == 0) {
+          continue;
+        }
+        float cost = 0.125f + (_surfaceArea(accum) * accumCount + rightArea[b + 1] * rightCount[b + 1]) / parentArea;
+        if (cost < bestCost) {
+          bestCost = cost;
+          bestAxis = axis;
+          bestBin = b;
+        }
+      }
+    }
+  }
+
+  size_t mid = begin;
+  if (bestAxis >= 0) {
+    float binScale = BVH_BIN_COUNT / centroidExtent[bestAxis];
+    float splitMin = centroidBounds.min[bestAxis];
+    BuildPrimitive* first = prims + begin;
+    BuildPrimitive* last = prims + end;
+    while (first < last) {
+      int b = (int)((first->centroid[bestAxis] - splitMin) * binScale);
+      if (KRCLAMP(b, 0, BVH_BIN_COUNT - 1) <= bestBin) {
+        first++;
+      } else {
+        last--;
+        BuildPrimitive tmp = *first;
+        *first = *last;
+        *last = tmp;
+      }
+    }
+    mid = begin + (first - (prims + begin));
+  } else if (count > 0xffff) {
+    // Too many primitives for a leaf and no useful split plane, which happens
+    // when every centroid coincides or the depth budget is spent.  Split the
+    // range in half.
+    mid = begin + count / 2;
+    bestAxis = 0;
+  }
+
+  if (bestAxis < 0 || mid == begin || mid == end) {
+    assert(count <= 0xffff);
+    nodes[nodeIndex].offset = (uint32_t)begin;
+    nodes[nodeIndex].count = (uint16_t)count;
+    return;
+  }
+
+  nodes[nodeIndex].axis = (uint16_t)bestAxis;
+  nodes[nodeIndex].count = 0;
+  _buildNode(nodes, prims, begin, mid, depth + 1);
+  nodes[nodeIndex].offset = (uint32_t)nodes.size();
+  _buildNode(nodes, prims, mid, end, depth + 1);
+}
+
+uint32_t _intersectNode(const AABB& bounds, const RayPacket& packet, uint32_t mask, const float* distance)
+{
+  uint32_t hitMask = 0;
+  int i = 0;
+#ifdef __SSE2__
+  // Four rays at a time, with the same operand order as the scalar test so
+  // that NaN slabs resolve the same way
+  __m128 minX = _mm_set1_ps(bounds.min.x);
+  __m128 minY = _mm_set1_ps(bounds.min.y);
+  __m128 minZ = _mm_set1_ps(bounds.min.z);
+  __m128 maxX = _mm_set1_ps(bounds.max.x);
+  __m128 maxY = _mm_set1_ps(bounds.max.y);
+  __m128 maxZ = _mm_set1_ps(bounds.max.z);
+  __m128 zero = _mm_setzero_ps();
+  for (; i + 4 <= packet.count; i += 4) {
+    if (((mask >> i) & 0xf) == 0) {
+      continue;
+    }
+    __m128 ox = _mm_loadu_ps(packet.origin_x + i);
+    __m128 oy = _mm_loadu_ps(packet.origin_y + i);
+    __m128 oz = _mm_loadu_ps(packet.origin_z + i);
+    __m128 ix = _mm_loadu_ps(packet.inv_dir_x + i);
+    __m128 iy = _mm_loadu_ps(packet.inv_dir_y + i);
+    __m128 iz = _mm_loadu_ps(packet.inv_dir_z + i);
+    __m128 tx1 = _mm_mul_ps(_mm_sub_ps(minX, ox), ix);
+    __m128 tx2 = _mm_mul_ps(_mm_sub_ps(maxX, ox), ix);
+    __m128 ty1 = _mm_mul_ps(_mm_sub_ps(minY, oy), iy);
+    __m128 ty2 = _mm_mul_ps(_mm_sub_ps(maxY, oy), iy);
+    __m128 tz1 = _mm_mul_ps(_mm_sub_ps(minZ, oz), iz);
+    __m128 tz2 = _mm_mul_ps(_mm_sub_ps(maxZ, oz), iz);
+    __m128 tmin = _mm_max_ps(_mm_max_ps(_mm_min_ps(tx1, tx2), _mm_min_ps(ty1, ty2)), _mm_max_ps(_mm_min_ps(tz1, tz2), zero));
+    __m128 tmax = _mm_min_ps(_mm_min_ps(_mm_max_ps(tx1, tx2), _mm_max_ps(ty1, ty2)), _mm_min_ps(_mm_max_ps(tz1, tz2), _mm_loadu_ps(distance + i)));
+    hitMask |= (uint32_t)_mm_movemask_ps(_mm_cmple_ps(tmin, tmax)) << i;
+  }
+#endif
+  for (; i < packet.count; i++) {
+    float tx1 = (bounds.min.x - packet.origin_x[i]) * packet.inv_dir_x[i];
+    float tx2 = (bounds.max.x - packet.origin_x[i]) * packet.inv_dir_x[i];
+    float ty1 = (bounds.min.y - packet.origin_y[i]) * packet.inv_dir_y[i];
+    float ty2 = (bounds.max.y - packet.origin_y[i]) * packet.inv_dir_y[i];
+    float tz1 = (bounds.min.z - packet.origin_z[i]) * packet.inv_dir_z[i];
+    float tz2 = (bounds.max.z - packet.origin_z[i]) * packet.inv_dir_z[i];
+    float tmin = KRMAX(KRMAX(KRMIN(tx1, tx2), KRMIN(ty1, ty2)), KRMAX(KRMIN(tz1, tz2), 0.0f));
+    float tmax = KRMIN(KRMIN(KRMAX(tx1, tx2), KRMAX(ty1, ty2)), KRMIN(KRMAX(tz1, tz2), distance[i]));
+    hitMask |= (uint32_t)(tmin <= tmax) << i;
+  }
+  return hitMask & mask;
+}
+
+void _intersectTriangle(const Triangle3& tri, uint32_t triangleIndex, const RayPacket& packet, uint32_t mask, float* distance, float* hit_u, float* hit_v, uint32_t* triangle)
+{
+  // Moller-Trumbore, evaluated for every ray in the packet
+  const float SMALL_NUM = 0.00000001f;
+  Vector3 e1 = tri[1] - tri[0];
+  Vector3 e2 = tri[2] - tri[0];
+  int i = 0;
+#ifdef __SSE2__
+  // Four rays at a time.  Rejections are written as in the scalar loop, so
+  // that a NaN passes or fails each test the same way.
+  __m128 e1x = _mm_set1_ps(e1.x);
+  __m128 e1y = _mm_set1_ps(e1.y);
+  __m128 e1z = _mm_set1_ps(e1.z);
+  __m128 e2x = _mm_set1_ps(e2.x);
+  __m128 e2y = _mm_set1_ps(e2.y);
+  __m128 e2z = _mm_set1_ps(e2.z);
+  __m128 t0x = _mm_set1_ps(tri[0].x);
+  __m128 t0y = _mm_set1_ps(tri[0].y);
+  __m128 t0z = _mm_set1_ps(tri[0].z);
+  __m128 zero = _mm_setzero_ps();
+  __m128 one = _mm_set1_ps(1.0f);
+  __m128 small = _mm_set1_ps(SMALL_NUM);
+  __m128 signBit = _mm_set1_ps(-0.0f);
+  for (; i + 4 <= packet.count; i += 4) {
+    if (((mask >> i) & 0xf) == 0) {
+      continue;
+    }
+    __m128 dx = _mm_loadu_ps(packet.dir_x + i);
+    __m128 dy = _mm_loadu_ps(packet.dir_y + i);
+    __m128 dz = _mm_loadu_ps(packet.dir_z + i);
+    __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+    __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+    __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+    __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+    __m128 reject = _mm_cmplt_ps(_mm_andnot_ps(signBit, det), small);
+    __m128 invDet = _mm_div_ps(one, det);
+    __m128 sx = _mm_sub_ps(_mm_loadu_ps(packet.origin_x + i), t0x);
+    __m128 sy = _mm_sub_ps(_mm_loadu_ps(packet.origin_y + i), t0y);
+    __m128 sz = _mm_sub_ps(_mm_loadu_ps(packet.origin_z + i), t0z);
+    __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)), invDet);
+    reject = _mm_or_ps(reject, _mm_or_ps(_mm_cmplt_ps(u, zero), _mm_cmpgt_ps(u, one)));
+    __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+    __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+    __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+    __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), invDet);
+    reject = _mm_or_ps(reject, _mm_or_ps(_mm_cmplt_ps(v, zero), _mm_cmpgt_ps(_mm_add_ps(u, v), one)));
+    __m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), invDet);
+    __m128 accept = _mm_and_ps(_mm_cmpge_ps(t, zero), _mm_cmplt_ps(t, _mm_loadu_ps(distance + i)));
+    uint32_t hits = (uint32_t)_mm_movemask_ps(_mm_andnot_ps(reject, accept)) & (mask >> i);
+    if (hits == 0) {
+      continue;
+    }
+    float lane_t[4];
+    float lane_u[4];
+    float lane_v[4];
+    _mm_storeu_ps(lane_t, t);
+    _mm_storeu_ps(lane_u, u);
+    _mm_storeu_ps(lane_v, v);
+    for (int j = 0; j < 4; j++) {
+      if (hits & (1u << j)) {
+        distance[i + j] = lane_t[j];
+        hit_u[i + j] = lane_u[j];
+        hit_v[i + j] = lane_v[j];
+        triangle[i + j] = triangleIndex;
+      }
+    }
+  }
+#endif
+  for (; i < packet.count; i++) {
+    if ((mask & (1u << i)) == 0) {
+      continue;
+    }
+    Vector3 dir = packet.direction(i);
+    Vector3 p = Vector3::Cross(dir, e2);
+    float det = Vector3::Dot(e1, p);
+    if (fabs(det) < SMALL_NUM) {
+      continue; // Ray is parallel to the triangle plane
+    }
+    float inv_det = 1.0f / det;
+    Vector3 s = packet.origin(i) - tri[0];
+    float u = Vector3::Dot(s, p) * inv_det;
+    if (u < 0.0f || u > 1.0f) {
+      continue;
+    }
+    Vector3 q = Vector3::Cross(s, e1);
+    float v = Vector3::Dot(dir, q) * inv_det;
+    if (v < 0.0f || u + v > 1.0f) {
+      continue;
+    }
+    float t = Vector3::Dot(e2, q) * inv_det;
+    if (t >= 0.0f && t < distance[i]) {
+      distance[i] = t;
+      hit_u[i] = u;
+      hit_v[i] = v;
+      triangle[i] = triangleIndex;
+    }
+  }
+}
+
+struct SweepHit
+{
+  float distance;
+  Vector3 point;
+  Vector3 normal;
+};
+
+Vector3 _closestPointOnSegment(const Vector3& a, const Vector3& b, const Vector3& p)
+{
+  Vector3 ab = b - a;
+  float len2 = Vector3::Dot(ab, ab);
+  if (len2 <= 0.0f) {
+    return a;
+  }
+  float t = KRCLAMP(Vector3::Dot(p - a, ab) / len2, 0.0f, 1.0f);
+  return a + ab * t;
+}
+
+float _closestPointsSegmentSegment(const Vector3& p1, const Vector3& q1, const Vector3& p2, const Vector3& q2, Vector3& c1, Vector3& c2)
+{
+  // From: Real-Time Collision Detection, Christer Ericson, 5.1.9
+  // Returns the squared distance between the segments p1q1 and p2q2
+  const float SMALL_NUM = 0.00000001f;
+  Vector3 d1 = q1 - p1;
+  Vector3 d2 = q2 - p2;
+  Vector3 r = p1 - p2;
+  float a = Vector3::Dot(d1, d1);
+  float e = Vector3::Dot(d2, d2);
+  float f = Vector3::Dot(d2, r);
+  float s, t;
+
+  if (a <= SMALL_NUM && e <= SMALL_NUM) {
+    // Both segments degenerate into points
+    s = t = 0.0f;
+  } else if (a <= SMALL_NUM) {
+    s = 0.0f;
+    t = KRCLAMP(f / e, 0.0f, 1.0f);
+  } else {
+    float c = Vector3::Dot(d1, r);
+    if (e <= SMALL_NUM) {
+      t = 0.0f;
+      s = KRCLAMP(-c / a, 0.0f, 1.0f);
+    } else {
+      float b = Vector3::Dot(d1, d2);
+      float denom = a * e - b * b;
+      s = denom != 0.0f ? KRCLAMP((b * f - c * e) / denom, 0.0f, 1.0f) : 0.0f;
+      t = (b * s + f) / e;
+      if (t < 0.0f) {
+        t = 0.0f;
+        s = KRCLAMP(-c / a, 0.0f, 1.0f);
+      } else if (t > 1.0f) {
+        t = 1.0f;
+        s = KRCLAMP((b - c) / a, 0.0f, 1.0f);
+      }
+    }
+  }
+  c1 = p1 + d1 * s;
+  c2 = p2 + d2 * t;
+  return (c1 - c2).sqrMagnitude();
+}
+
+bool _insideTriangle(const Triangle3& tri, const Vector3& normal, const Vector3& p)
+{
+  // p is assumed to lie on the triangle's plane
+  return Vector3::Dot(Vector3::Cross(tri[1] - tri[0], p - tri[0]), normal) >= 0.0f
+    && Vector3::Dot(Vector3::Cross(tri[2] - tri[1], p - tri[1]), normal) >= 0.0f
+    && Vector3::Dot(Vector3::Cross(tri[0] - tri[2], p - tri[2]), normal) >= 0.0f;
+}
+
+Vector2 _barycentric(const Triangle3& tri, const Vector3& p)
+{
+  // Returns the weights of the second and third vertices
+  Vector3 v0 = tri[1] - tri[0];
+  Vector3 v1 = tri[2] - tri[0];
+  Vector3 v2 = p - tri[0];
+  float d00 = Vector3::Dot(v0, v0);
+  float d01 = Vector3::Dot(v0, v1);
+  float d11 = Vector3::Dot(v1, v1);
+  float d20 = Vector3::Dot(v2, v0);
+  float d21 = Vector3::Dot(v2, v1);
+  float denom = d00 * d11 - d01 * d01;
+  if (denom == 0.0f) {
+    return Vector2::Zero();
+  }
+  return Vector2::Create((d11 * d20 - d01 * d21) / denom, (d00 * d21 - d01 * d20) / denom);
+}
+
+bool _raySphere(const Vector3& start, const Vector3& dir, const Vector3& center, float radius, float& distance)
+{
+  // dir must be normalized
+  Vector3 m = start - center;
+  float b = Vector3::Dot(m, dir);
+  float c = Vector3::Dot(m, m) - radius * radius;
+  if (c > 0.0f && b > 0.0f) {
+    return false;
+  }
+  float disc = b * b - c;
+  if (disc < 0.0f) {
+    return false;
+  }
+  distance = KRMAX(-b - sqrtf(disc), 0.0f);
+  return true;
+}
+
+bool _rayCylinder(const Vector3& start, const Vector3& dir, const Vector3& a, const Vector3& b, float radius, float& distance)
+{
+  // Intersects the curved surface of the cylinder around segment ab.  Hits
+  // beyond the ends of the segment are left to sphere tests on the end points.
+  // From: Real-Time Collision Detection, Christer Ericson, 5.3.7
+  const float SMALL_NUM = 0.00000001f;
+  Vector3 d = b - a;
+  Vector3 m = start - a;
+  float md = Vector3::Dot(m, d);
+  float nd = Vector3::Dot(dir, d);
+  float dd = Vector3::Dot(d, d);
+  float nn = Vector3::Dot(dir, dir);
+  float mn = Vector3::Dot(m, dir);
+  float qa = dd * nn - nd * nd;
+  if (qa < SMALL_NUM) {
+    return false; // Ray is parallel to the cylinder axis
+  }
+  float k = Vector3::Dot(m, m) - radius * radius;
+  float qc = dd * k - md * md;
+  float qb = dd * mn - nd * md;
+  float disc = qb * qb - qa * qc;
+  if (disc < 0.0f) {
+    return false;
+  }
+  float t = (-qb - sqrtf(disc)) / qa;
+  if (t < 0.0f) {
+    return false;
+  }
+  float s = md + t * nd;
+  if (s < 0.0f || s > dd) {
+    return false;
+  }
+  distance = t;
+  return true;
+}
+
+bool _sphereOverlap(const Triangle3& tri, const Plane& plane, const Vector3& center, float radius, SweepHit& hit)
+{
+  Vector3 closest = tri.closestPointOnTriangle(center);
+  Vector3 delta = center - closest;
+  float d2 = delta.sqrMagnitude();
+  if (d2 > radius * radius) {
+    return false;
+  }
+  hit.distance = 0.0f;
+  hit.point = closest;
+  hit.normal = d2 > 0.0f ? delta / sqrtf(d2) : plane.normal;
+  return true;
+}
+
+bool _sweepSphere(const Triangle3& tri, const Plane& plane, const Vector3& start, const Vector3& dir, float radius, float maxDistance, SweepHit& hit)
+{
+  // Assumes the sphere does not overlap the triangle at the start of the sweep
+  const Vector3& normal = plane.normal;
+  float side = plane.distance(start);
+  Vector3 facing = side < 0.0f ? -normal : normal;
+  float height = fabs(side);
+
+  // Contact with the face is always the earliest, when it occurs
+  float denom = Vector3::Dot(facing, dir);
+  if (denom < 0.0f && height > radius) {
+    float t = (height - radius) / -denom;
+    if (t > maxDistance) {
+      return false;
+    }
+    Vector3 p = start + dir * t - facing * radius;
+    if (_insideTriangle(tri, normal, p)) {
+      hit.distance = t;
+      hit.point = p;
+      hit.normal = facing;
+      return true;
+    }
+  }
+
+  // Otherwise the sphere hits an edge or a vertex first
+  float best = maxDistance;
+  bool found = false;
+  Vector3 contact;
+  for (int i = 0; i < 3; i++) {
+    float t;
+    const Vector3& a = tri.vert[i];
+    const Vector3& b = tri.vert[(i + 1) % 3];
+    if (_rayCylinder(start, dir, a, b, radius, t) && t <= best) {
+      best = t;
+      contact = _closestPointOnSegment(a, b, start + dir * t);
+      found = true;
+    }
+    if (_raySphere(start, dir, a, radius, t) && t <= best) {
+      best = t;
+      contact = a;
+      found = true;
+    }
+  }
+  if (!found) {
+    return false;
+  }
+  hit.distance = best;
+  hit.point = contact;
+  hit.normal = Vector3::Normalize(start + dir * best - contact);
+  return true;
+}
+
+bool _sweepCapsule(const Triangle3& tri, const Plane& plane, const Vector3& start1, const Vector3& start2, const Vector3& dir, float radius, float maxDistance, SweepHit& hit)
+{
+  // The first contact between a translating capsule and a triangle is either
+  // one of the capsule's end spheres touching the triangle, the capsule's
+  // cylinder touching a triangle vertex, or the capsule axis passing an edge.
+
+  // Test for overlap at the start of the sweep
+  const Vector3& normal = plane.normal;
+  float side1 = plane.distance(start1);
+  float side2 = plane.distance(start2);
+  if ((side1 < 0.0f) != (side2 < 0.0f)) {
+    Vector3 crossing = start1 + (start2 - start1) * (side1 / (side1 - side2));
+    if (_insideTriangle(tri, normal, crossing)) {
+      hit.distance = 0.0f;
+      hit.point = crossing;
+      hit.normal = side1 < 0.0f ? -normal : normal;
+      return true;
+    }
+  }
+  // Otherwise find the closest pair of points between the axis and the
+  // triangle, which lies on an end point or on one of the triangle's edges
+  float closestD2 = radius * radius;
+  bool overlap = false;
+  Vector3 onAxis, onTriangle;
+  for (int i = 0; i < 2; i++) {
+    const Vector3& p = i == 0 ? start1 : start2;
+    Vector3 closest = tri.closestPointOnTriangle(p);
+    float d2 = (p - closest).sqrMagnitude();
+    if (d2 <= closestD2) {
+      closestD2 = d2;
+      onAxis = p;
+      onTriangle = closest;
+      overlap = true;
+    }
+  }
+  for (int i = 0; i < 3; i++) {
+    Vector3 a, b;
+    float d2 = _closestPointsSegmentSegment(start1, start2, tri.vert[i], tri.vert[(i + 1) % 3], a, b);
+    if (d2 <= closestD2) {
+      closestD2 = d2;
+      onAxis = a;
+      onTriangle = b;
+      overlap = true;
+    }
+  }
+  if (overlap) {
+    hit.distance = 0.0f;
+    hit.point = onTriangle;
+    hit.normal = closestD2 > 0.0f ? (onAxis - onTriangle) / sqrtf(closestD2) : (side1 < 0.0f ? -normal : normal);
+    return true;
+  }
+
+  bool found = false;
+  SweepHit candidate;
+  float best = maxDistance;
+
+  // End spheres
+  if (_sweepSphere(tri, plane, start1, dir, radius, best, candidate)) {
+    hit = candidate;
+    best = candidate.distance;
+    found = true;
+  }
+  if (_sweepSphere(tri, plane, start2, dir, radius, best, candidate)) {
+    hit = candidate;
+    best = candidate.distance;
+    found = true;
+  }
+
+  for (int i = 0; i < 3; i++) {
+    const Vector3& a = tri.vert[i];
+    const Vector3& b = tri.vert[(i + 1) % 3];
+    float t;
+
+    // Triangle vertex against the capsule's cylinder, cast in reverse
+    if (_rayCylinder(a, -dir, start1, start2, radius, t) && t <= best) {
+      Vector3 axisPoint = _closestPointOnSegment(start1, start2, a - dir * t) + dir * t;
+      best = t;
+      hit.distance = t;
+      hit.point = a;
+      hit.normal = Vector3::Normalize(axisPoint - a);
+      found = true;
+    }
+
+    // Capsule axis against the edge.  In the frame of the capsule, the edge
+    // sweeps out a parallelogram; find where the ray first comes within radius
+    // of its interior.
+    Vector3 u = b - a;
+    Vector3 w = start1 - start2;
+    Vector3 m = Vector3::Cross(u, w);
+    float m2 = m.sqrMagnitude();
+    if (m2 <= 0.00000001f * u.sqrMagnitude() * w.sqrMagnitude()) {
+      continue; // Parallel edges are covered by the end sphere and vertex tests
+    }
+    m /= sqrtf(m2);
+    Vector3 origin = a - start1;
+    float h = -Vector3::Dot(m, origin);
+    if (h < 0.0f) {
+      m = -m;
+      h = -h;
+    }
+    float denom = Vector3::Dot(m, dir);
+    if (h <= radius || denom >= 0.0f) {
+      continue;
+    }
+    t = (h - radius) / -denom;
+    if (t > best) {
+      continue;
+    }
+    // Solve for the parallelogram coordinates of the contact point
+    Vector3 q = dir * t - m * radius - origin;
+    float uu = Vector3::Dot(u, u);
+    float uw = Vector3::Dot(u, w);
+    float ww = Vector3::Dot(w, w);
+    float qu = Vector3::Dot(q, u);
+    float qw = Vector3::Dot(q, w);
+    float denom2 = uu * ww - uw * uw;
+    float alpha = (qu * ww - qw * uw) / denom2;
+    float beta = (qw * uu - qu * uw) / denom2;
+    if (alpha < 0.0f || alpha > 1.0f || beta < 0.0f || beta > 1.0f) {
+      continue;
+    }
+    best = t;
+    hit.distance = t;
+    hit.point = a + u * alpha;
+    hit.normal = m;
+    found = true;
+  }
+  return found;
+}
+
+bool _sweepBox(const AABB& bounds, const Vector3& center, const Vector3& halfExtent, const Vector3& invDir, float maxDistance, float& entry)
+{
+  // Slab test of a ray against the bounds grown by the half extent of the
+  // swept shape's own bounding box
+  Vector3 bmin = bounds.min - halfExtent - center;
+  Vector3 bmax = bounds.max + halfExtent - center;
+  float tx1 = bmin.x * invDir.x;
+  float tx2 = bmax.x * invDir.x;
+  float ty1 = bmin.y * invDir.y;
+  float ty2 = bmax.y * invDir.y;
+  float tz1 = bmin.z * invDir.z;
+  float tz2 = bmax.z * invDir.z;
+  float tmin = KRMAX(KRMAX(KRMIN(tx1, tx2), KRMIN(ty1, ty2)), KRMAX(KRMIN(tz1, tz2), 0.0f));
+  float tmax = KRMIN(KRMIN(KRMAX(tx1, tx2), KRMAX(ty1, ty2)), KRMIN(KRMAX(tz1, tz2), maxDistance));
+  entry = tmin;
+  return tmin <= tmax;
+}
+
+bool _sharesVertex(const Triangle3& a, const Triangle3& b)
+{
+  for (int i = 0; i < 3; i++) {
+    if (a[i] == b[0] || a[i] == b[1] || a[i] == b[2]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t _alignBlob(size_t offset)
+{
+  return (offset + Archive::ALIGNMENT - 1) & ~(Archive::ALIGNMENT - 1);
+}
+
+bool _arrayFits(const BlobHeader& header, uint64_t offset, uint64_t count, size_t elementSize)
+{
+  return offset % Archive::ALIGNMENT == 0
+    && offset <= header.size
+    && count <= (header.size - offset) / elementSize;
+}
+
+// Returns the header if blob holds a complete hierarchy of this version and
+// layout, otherwise nullptr
+const BlobHeader* _blobHeader(const void* blob, size_t size)
+{
+  if (blob == nullptr || ((uintptr_t)blob & 7) != 0 || size < sizeof(BlobHeader)) {
+    return nullptr;
+  }
+  const BlobHeader* header = (const BlobHeader*)blob;
+  if (header->magic != BVH_BLOB_MAGIC
+    || header->version != BVH_BLOB_VERSION
+    || header->endianTag != Archive::ENDIAN_TAG
+    || header->nodeSize != sizeof(BVHNode)
+    || header->size < sizeof(BlobHeader)
+    || header->size > size) {
+    return nullptr;
+  }
+  if (!_arrayFits(*header, header->nodeOffset, header->nodeCount, sizeof(BVHNode))
+    || !_arrayFits(*header, header->triangleOffset, header->triangleCount, sizeof(Triangle3))
+    || !_arrayFits(*header, header->triangleIndexOffset, header->triangleCount, sizeof(uint32_t))
+    || !_arrayFits(*header, header->planeOffset, header->triangleCount, sizeof(Plane))) {
+    return nullptr;
+  }
+  return header;
+}
+
+uint64_t _blobChecksum(const uint8_t* blob, size_t size)
+{
+  BlobHeader header;
+  memcpy(&header, blob, sizeof(header));
+  header.checksum = 0;
+  uint64_t seed = Hash::Bytes(&header, sizeof(header), 0);
+  return Hash::Bytes(blob + sizeof(BlobHeader), size - sizeof(BlobHeader), seed);
+}
+
+// Checks that traversal stays within the arrays and the fixed size traversal
+// stacks.  Children always follow their parent, which also rules out cycles.
+bool _validNodes(const BVHNode* nodes, size_t nodeCount, size_t triangleCount)
+{
+  std::vector<uint8_t> depth(nodeCount, 0);
+  for (size_t i = 0; i < nodeCount; i++) {
+    const BVHNode& node = nodes[i];
+    if (node.isLeaf()) {
+      if ((uint64_t)node.offset + node.count > triangleCount) {
+        return false;
+      }
+      continue;
+    }
+    if (node.offset <= i + 1 || node.offset >= nodeCount || depth[i] + 1 >= BVH_MAX_DEPTH) {
+      return false;
+    }
+    depth[i + 1] = KRMAX(depth[i + 1], (uint8_t)(depth[i] + 1));
+    depth[node.offset] = KRMAX(depth[node.offset], (uint8_t)(depth[i] + 1));
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+bool BVHNode::isLeaf() const
+{
+  return count != 0;
+}
+
+BVH::BVH()
+  : m_nodes(nullptr)
+  , m_triangles(nullptr)
+  , m_triangleIndices(nullptr)
+  , m_planes(nullptr)
+  , m_nodeCount(0)
+  , m_triangleCount(0)
+  , m_view(false)
+{
+
+}
+
+BVH::BVH(const BVH& other)
+  : BVH()
+{
+  *this = other;
+}
+
+BVH::~BVH()
+{
+
+}
+
+BVH& BVH::operator=(const BVH& other)
+{
+  if (this == &other) {
+    return *this;
+  }
+  m_nodeStorage = other.m_nodeStorage;
+  m_triangleStorage = other.m_triangleStorage;
+  m_triangleIndexStorage = other.m_triangleIndexStorage;
+  m_planeStorage = other.m_planeStorage;
+  if (other.m_view) {
+    // Views share the blob, which the caller keeps alive
+    m_nodes = other.m_nodes;
+    m_triangles = other.m_triangles;
+    m_triangleIndices = other.m_triangleIndices;
+    m_planes = other.m_planes;
+    m_nodeCount = other.m_nodeCount;
+    m_triangleCount = other.m_triangleCount;
+    m_view = true;
+  } else {
+    attachStorage();
+  }
+  return *this;
+}
+
+void BVH::clear()
+{
+  m_nodeStorage.clear();
+  m_triangleStorage.clear();
+  m_triangleIndexStorage.clear();
+  m_planeStorage.clear();
+  attachStorage();
+}
+
+void BVH::attachStorage()
+{
+  m_nodes = m_nodeStorage.data();
+  m_triangles = m_triangleStorage.data();
+  m_triangleIndices = m_triangleIndexStorage.data();
+  m_planes = m_planeStorage.data();
+  m_nodeCount = m_nodeStorage.size();
+  m_triangleCount = m_triangleStorage.size();
+  m_view = false;
+}
+
+void BVH::build(const Triangle3* triangles, size_t count)
+{
+  Arena scratch;
+  build(triangles, count, scratch);
+}
+
+void BVH::build(const Triangle3* triangles, size_t count, Arena& scratch)
+{
+  HYDRA_PROFILE_SCOPE("BVH::build");
+  clear();
+  if (count == 0) {
+    return;
+  }
+
+  BuildPrimitive* prims = scratch.allocate<BuildPrimitive>(count);
+  for (size_t i = 0; i < count; i++) {
+    prims[i].bounds = _triangleBounds(triangles[i]);
+    prims[i].centroid = prims[i].bounds.center();
+    prims[i].index = (uint32_t)i;
+  }
+
+  m_nodeStorage.reserve(count * 2 / BVH_MAX_LEAF_SIZE + 1);
+  _buildNode(m_nodeStorage, prims, 0, count, 0);
+
+  m_triangleStorage.resize(count);
+  m_triangleIndexStorage.resize(count);
+  m_planeStorage.resize(count);
+  for (size_t i = 0; i < count; i++) {
+    const Triangle3& tri = triangles[prims[i].index];
+    m_triangleStorage[i] = tri;
+    m_triangleIndexStorage[i] = prims[i].index;
+    Vector3 normal = Vector3::Cross(tri[1] - tri[0], tri[2] - tri[0]);
+    float length = normal.magnitude();
+    normal = length > 0.0f ? normal / length : Vector3::Zero();
+    m_planeStorage[i] = Plane::Create(normal, tri[0]);
+  }
+  attachStorage();
+}
+
+void BVH::build(const IndexedMesh& mesh)
+{
+  Arena scratch;
+  build(mesh, scratch);
+}
+
+void BVH::build(const IndexedMesh& mesh, Arena& scratch)
+{
+  HYDRA_PROFILE_SCOPE("BVH::build");
+  clear();
+  size_t count = mesh.triangleCount();
+  if (count == 0) {
+    return;
+  }
+
+  BuildPrimitive* prims = scratch.allocate<BuildPrimitive>(count);
+  for (size_t i = 0; i < count; i++) {
+    prims[i].bounds = mesh.getTriangleBounds(i);
+    prims[i].centroid = prims[i].bounds.center();
+    prims[i].index = (uint32_t)i;
+  }
+
+  m_nodeStorage.reserve(count * 2 / BVH_MAX_LEAF_SIZE + 1);
+  _buildNode(m_nodeStorage, prims, 0, count, 0);
+
+  m_triangleStorage.resize(count);
+  m_triangleIndexStorage.resize(count);
+  m_planeStorage.resize(count);
+  for (size_t i = 0; i < count; i++) {
+    uint32_t index = prims[i].index;
+    m_triangleStorage[i] = mesh.getTriangle(index);
+    m_triangleIndexStorage[i] = index;
+    m_planeStorage[i] = Plane::Create(mesh.getNormal(index), m_triangleStorage[i][0]);
+  }
+  attachStorage();
+}
+
+size_t BVH::nodeCount() const
+{
+  return m_nodeCount;
+}
+
+size_t BVH::triangleCount() const
+{
+  return m_triangleCount;
+}
+
+void BVH::serialize(std::vector<uint8_t>& blob) const
+{
+  HYDRA_PROFILE_SCOPE("BVH::serialize");
+  BlobHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic = BVH_BLOB_MAGIC;
+  header.version = BVH_BLOB_VERSION;
+  header.endianTag = Archive::ENDIAN_TAG;
+  header.nodeSize = sizeof(BVHNode);
+  header.nodeCount = m_nodeCount;
+  header.triangleCount = m_triangleCount;
+
+  size_t offset = _alignBlob(sizeof(BlobHeader));
+  header.nodeOffset = offset;
+  offset = _alignBlob(offset + m_nodeCount * sizeof(BVHNode));
+  header.triangleOffset = offset;
+  offset = _alignBlob(offset + m_triangleCount * sizeof(Triangle3));
+  header.triangleIndexOffset = offset;
+  offset = _alignBlob(offset + m_triangleCount * sizeof(uint32_t));
+  header.planeOffset = offset;
+  offset = _alignBlob(offset + m_triangleCount * sizeof(Plane));
+  header.size = offset;
+
+  blob.assign(offset, 0);
+  if (m_nodeCount > 0) {
+    memcpy(&blob[(size_t)header.nodeOffset], m_nodes, m_nodeCount * sizeof(BVHNode));
+  }
+  if (m_triangleCount > 0) {
+    memcpy(&blob[(size_t)header.triangleOffset], m_triangles, m_triangleCount * sizeof(Triangle3));
+    memcpy(&blob[(size_t)header.triangleIndexOffset], m_triangleIndices, m_triangleCount * sizeof(uint32_t));
+    memcpy(&blob[(size_t)header.planeOffset], m_planes, m_triangleCount * sizeof(Plane));
+  }
+  memcpy(&blob[0], &header, sizeof(header));
+  header.checksum = _blobChecksum(&blob[0], blob.size());
+  memcpy(&blob[0], &header, sizeof(header));
+}
+
+void BVH::write(ArchiveWriter& archive, uint32_t id) const
+{
+  std::vector<uint8_t> blob;
+  serialize(blob);
+  archive.add(id, ArchiveType::BVH, blob.data(), 1, blob.size());
+}
+
+bool BVH::view(const void* blob, size_t size)
+{
+  HYDRA_PROFILE_SCOPE("BVH::view");
+  const BlobHeader* header = _blobHeader(blob, size);
+  if (header == nullptr) {
+    return false;
+  }
+  clear();
+  const uint8_t* base = (const uint8_t*)blob;
+  m_nodes = (const BVHNode*)(base + header->nodeOffset);
+  m_triangles = (const Triangle3*)(base + header->triangleOffset);
+  m_triangleIndices = (const uint32_t*)(base + header->triangleIndexOffset);
+  m_planes = (const Plane*)(base + header->planeOffset);
+  m_nodeCount = (size_t)header->nodeCount;
+  m_triangleCount = (size_t)header->triangleCount;
+  m_view = true;
+  return true;
+}
+
+bool BVH::view(const Archive& archive, uint32_t id)
+{
+  const void* blob;
+  size_t size;
+  if (!archive.get(id, ArchiveType::BVH, 1, blob, size)) {
+    return false;
+  }
+  return view(blob, size);
+}
+
+bool BVH::isView() const
+{
+  return m_view;
+}
+
+bool BVH::Verify(const void* blob, size_t size)
+{
+  HYDRA_PROFILE_SCOPE("BVH::Verify");
+  const BlobHeader* header = _blobHeader(blob, size);
+  if (header == nullptr) {
+    return false;
+  }
+  const uint8_t* data = (const uint8_t*)blob;
+  if (_blobChecksum(data, (size_t)header->size) != header->checksum) {
+    return false;
+  }
+  return _validNodes((const BVHNode*)(data + header->nodeOffset), (size_t)header->nodeCount, (size_t)header->triangleCount);
+}
+
+AABB BVH::bounds() const
+{
+  if (m_nodeCount == 0) {
+    return AABB::Zero();
+  }
+  return m_nodes[0].bounds;
+}
+
+void BVH::rayCast(const RayPacket& packet, float* distance, float* u, float* v, uint32_t* triangle) const
+{
+  for (int i = 0; i < packet.count; i++) {
+    distance[i] = packet.max_distance[i];
+    u[i] = 0.0f;
+    v[i] = 0.0f;
+    triangle[i] = BVH_NO_HIT;
+  }
+  if (m_nodeCount == 0 || packet.active_mask == 0) {
+    return;
+  }
+
+  struct StackEntry
+  {
+    uint32_t node;
+    uint32_t mask;
+  } stack[BVH_MAX_DEPTH];
+  int stackSize = 0;
+  stack[stackSize].node = 0;
+  stack[stackSize].mask = packet.active_mask;
+  stackSize++;
+
+  while (stackSize > 0) {
+    stackSize--;
+    const BVHNode& node = m_nodes[stack[stackSize].node];
+    uint32_t nodeIndex = stack[stackSize].node;
+
+    // Re-test on pop, as hits found since the node was pushed may cull it
+    uint32_t mask = _intersectNode(node.bounds, packet, stack[stackSize].mask, distance);
+    if (mask == 0) {
+      continue;
+    }
+
+    if (node.isLeaf()) {
+      for (uint32_t t = node.offset; t < node.offset + node.count; t++) {
+        _intersectTriangle(m_triangles[t], t, packet, mask, distance, u, v, triangle);
+      }
+      continue;
+    }
+
+    // Visit the near child first, ordered by the direction of the first
+    // active ray.  Coherent packets share the same ordering.
+    int firstActive = 0;
+    while ((mask & (1u << firstActive)) == 0) {
+      firstActive++;
+    }
+    float dir = node.axis == 0 ? packet.dir_x[firstActive] : node.axis == 1 ? packet.dir_y[firstActive] : packet.dir_z[firstActive];
+    uint32_t nearChild = nodeIndex + 1;
+    uint32_t farChild = node.offset;
+    if (dir < 0.0f) {
+      nearChild = node.offset;
+      farChild = nodeIndex + 1;
+    }
+    assert(stackSize + 2 <= BVH_MAX_DEPTH);
+    stack[stackSize].node = farChild;
+    stack[stackSize].mask = mask;
+    stackSize++;
+    stack[stackSize].node = nearChild;
+    stack[stackSize].mask = mask;
+    stackSize++;
+  }
+}
+
+void BVH::rayCast(const RayPacket& packet, HitInfo* hits) const
+{
+  HYDRA_PROFILE_SCOPE("BVH::rayCast(packet)");
+  float distance[RayPacket::MAX_RAYS];
+  float u[RayPacket::MAX_RAYS];
+  float v[RayPacket::MAX_RAYS];
+  uint32_t triangle[RayPacket::MAX_RAYS];
+  rayCast(packet, distance, u, v, triangle);
+
+  for (int i = 0; i < packet.count; i++) {
+    if (triangle[i] == BVH_NO_HIT) {
+      hits[i].init();
+    } else {
+      hits[i].init(packet.origin(i) + packet.direction(i) * distance[i],
+                   m_planes[triangle[i]].normal,
+                   distance[i],
+                   Vector2::Create(u[i], v[i]),
+                   m_triangleIndices[triangle[i]],
+                   HitInfo::INVALID_ID);
+    }
+  }
+}
+
+void BVH::rayCast(const Vector3* starts, const Vector3* dirs, size_t count, HitInfo* hits) const
+{
+  HYDRA_PROFILE_SCOPE("BVH::rayCast(batch)");
+  RayPacket packet;
+  for (size_t i = 0; i < count; i += RayPacket::MAX_RAYS) {
+    int packetSize = (int)KRMIN(count - i, (size_t)RayPacket::MAX_RAYS);
+    packet.init(starts + i, dirs + i, packetSize);
+    rayCast(packet, hits + i);
+  }
+}
+
+void BVH::rayCast(const Vector3* starts, const Vector3* dirs, size_t count, HitInfo* hits, Scheduler& scheduler) const
+{
+  HYDRA_PROFILE_SCOPE("BVH::rayCast(batch, scheduler)");
+  size_t packetCount = (count + RayPacket::MAX_RAYS - 1) / RayPacket::MAX_RAYS;
+  scheduler.parallelFor(0, packetCount, BVH_PACKETS_PER_TASK, [=](size_t begin, size_t end) {
+    size_t first = begin * RayPacket::MAX_RAYS;
+    size_t last = KRMIN(end * RayPacket::MAX_RAYS, count);
+    rayCast(starts + first, dirs + first, last - first, hits + first);
+  });
+}
+
+bool BVH::rayCast(const Vector3& start, const Vector3& dir, HitInfo& hit) const
+{
+  HYDRA_PROFILE_SCOPE("BVH::rayCast");
+  RayPacket packet;
+  packet.init(&start, &dir, 1);
+  rayCast(packet, &hit);
+  return hit.didHit();
+}
+
+bool BVH::sweep(const Vector3& start1, const Vector3& start2, const Vector3& dir, float radius, float maxDistance, HitInfo& hit) const
+{
+  hit.init();
+  if (m_nodeCount == 0) {
+    return false;
+  }
+
+  bool isSphere = start1 == start2;
+  Vector3 center = (start1 + start2) * 0.5f;
+  Vector3 halfExtent = (Vector3::Max(start1, start2) - Vector3::Min(start1, start2)) * 0.5f + Vector3::Create(radius);
+  Vector3 invDir = Vector3::Create(1.0f / dir.x, 1.0f / dir.y, 1.0f / dir.z);
+
+  float best = maxDistance;
+  uint32_t bestTriangle = BVH_NO_HIT;
+  SweepHit bestHit;
+
+  struct StackEntry
+  {
+    uint32_t node;
+    float entry;
+  } stack[BVH_MAX_DEPTH];
+  int stackSize = 0;
+
+  float entry;
+  if (!_sweepBox(m_nodes[0].bounds, center, halfExtent, invDir, best, entry)) {
+    return false;
+  }
+  stack[stackSize].node = 0;
+  stack[stackSize].entry = entry;
+  stackSize++;
+
+  while (stackSize > 0) {
+    stackSize--;
+    if (stack[stackSize].entry > best) {
+      continue;
+    }
+    uint32_t nodeIndex = stack[stackSize].node;
+    const BVHNode& node = m_nodes[nodeIndex];
+
+    if (node.isLeaf()) {
+      for (uint32_t t = node.offset; t < node.offset + node.count; t++) {
+        SweepHit candidate;
+        bool didHit;
+        if (isSphere) {
+          didHit = _sphereOverlap(m_triangles[t], m_planes[t], start1, radius, candidate)
+            || _sweepSphere(m_triangles[t], m_planes[t], start1, dir, radius, best, candidate);
+        } else {
+          didHit = _sweepCapsule(m_triangles[t], m_planes[t], start1, start2, dir, radius, best, candidate);
+        }
+        if (didHit && (candidate.distance < best || bestTriangle == BVH_NO_HIT)) {
+          best = candidate.distance;
+          bestHit = candidate;
+          bestTriangle = t;
+        }
+      }
+      continue;
+    }
+
+    // Push the farther child first, so that the nearer one is visited next
+    float entryA, entryB;
+    uint32_t childA = nodeIndex + 1;
+    uint32_t childB = node.offset;
+    bool hitA = _sweepBox(m_nodes[childA].bounds, center, halfExtent, invDir, best, entryA);
+    bool hitB = _sweepBox(m_nodes[childB].bounds, center, halfExtent, invDir, best, entryB);
+    if (hitA && hitB && entryA < entryB) {
+      uint32_t tmpChild = childA;
+      childA = childB;
+      childB = tmpChild;
+      float tmpEntry = entryA;
+      entryA = entryB;
+      entryB = tmpEntry;
+    }
+    assert(stackSize + 2 <= BVH_MAX_DEPTH);
+    if (hitA) {
+      stack[stackSize].node = childA;
+      stack[stackSize].entry = entryA;
+      stackSize++;
+    }
+    if (hitB) {
+      stack[stackSize].node = childB;
+      stack[stackSize].entry = entryB;
+      stackSize++;
+    }
+  }
+
+  if (bestTriangle == BVH_NO_HIT) {
+    return false;
+  }
+  hit.init(bestHit.point, bestHit.normal, bestHit.distance,
+           _barycentric(m_triangles[bestTriangle], bestHit.point),
+           m_triangleIndices[bestTriangle], HitInfo::INVALID_ID);
+  return true;
+}
+
+bool BVH::sphereCast(const Vector3& start, const Vector3& dir, float radius, float maxDistance, HitInfo& hit) const
+{
+  HYDRA_PROFILE_SCOPE("BVH::sphereCast");
+  return sweep(start, start, dir, radius, maxDistance, hit);
+}
+
+bool BVH::capsuleCast(const Vector3& start1, const Vector3& start2, const Vector3& dir, float radius, float maxDistance, HitInfo& hit) const
+{
+  HYDRA_PROFILE_SCOPE("BVH::capsuleCast");
+  return sweep(start1, start2, dir, radius, maxDistance, hit);
+}
+
+bool BVH::closestPoint(const Vector3& p, HitInfo& hit) const
+{
+  return closestPoint(p, std::numeric_limits<float>::max(), hit);
+}
+
+bool BVH::closestPoint(const Vector3& p, float maxDistance, HitInfo& hit) const
+{
+  HYDRA_PROFILE_SCOPE("BVH::closestPoint");
+  hit.init();
+  if (m_nodeCount == 0) {
+    return false;
+  }
+
+  // Branch and bound; the distance from p to a node's bounds is a lower bound
+  // for the distance to any triangle within it.
+  float best = maxDistance * maxDistance;
+  uint32_t bestTriangle = BVH_NO_HIT;
+  Vector3 bestPoint;
+  Vector2 bestBarycentric;
+
+  struct StackEntry
+  {
+    uint32_t node;
+    float sqrDistance;
+  } stack[BVH_MAX_DEPTH];
+  int stackSize = 0;
+  stack[stackSize].node = 0;
+  stack[stackSize].sqrDistance = (m_nodes[0].bounds.nearestPoint(p) - p).sqrMagnitude();
+  stackSize++;
+
+  while (stackSize > 0) {
+    stackSize--;
+    if (stack[stackSize].sqrDistance > best) {
+      continue;
+    }
+    uint32_t nodeIndex = stack[stackSize].node;
+    const BVHNode& node = m_nodes[nodeIndex];
+
+    if (node.isLeaf()) {
+      for (uint32_t t = node.offset; t < node.offset + node.count; t++) {
+        Vector2 barycentric;
+        Vector3 point = m_triangles[t].closestPointOnTriangle(p, barycentric);
+        float sqrDistance = (point - p).sqrMagnitude();
+        if (sqrDistance <= best) {
+          best = sqrDistance;
+          bestTriangle = t;
+          bestPoint = point;
+          bestBarycentric = barycentric;
+        }
+      }
+      continue;
+    }
+
+    uint32_t childA = nodeIndex + 1;
+    uint32_t childB = node.offset;
+    float distanceA = (m_nodes[childA].bounds.nearestPoint(p) - p).sqrMagnitude();
+    float distanceB = (m_nodes[childB].bounds.nearestPoint(p) - p).sqrMagnitude();
+    if (distanceA < distanceB) {
+      uint32_t tmpChild = childA;
+      childA = childB;
+      childB = tmpChild;
+      float tmpDistance = distanceA;
+      distanceA = distanceB;
+      distanceB = tmpDistance;
+    }
+    // Push the farther child first, so that the nearer one is visited next
+    assert(stackSize + 2 <= BVH_MAX_DEPTH);
+    if (distanceA <= best) {
+      stack[stackSize].node = childA;
+      stack[stackSize].sqrDistance = distanceA;
+      stackSize++;
+    }
+    if (distanceB <= best) {
+      stack[stackSize].node = childB;
+      stack[stackSize].sqrDistance = distanceB;
+      stackSize++;
+    }
+  }
+
+  if (bestTriangle == BVH_NO_HIT) {
+    return false;
+  }
+  hit.init(bestPoint, m_planes[bestTriangle].normal, sqrtf(best), bestBarycentric,
+           m_triangleIndices[bestTriangle], HitInfo::INVALID_ID);
+  return true;
+}
+
+uint32_t BVH::countCrossings(const Vector3& start, const Vector3& dir) const
+{
+  if (m_nodeCount == 0) {
+    return 0;
+  }
+
+  RayPacket packet;
+  packet.init(&start, &dir, 1);
+  float distance = std::numeric_limits<float>::max();
+  float u, v;
+  uint32_t triangle;
+  uint32_t crossings = 0;
+
+  uint32_t stack[BVH_MAX_DEPTH];
+  int stackSize = 0;
+  stack[stackSize++] = 0;
+  while (stackSize > 0) {
+    const BVHNode& node = m_nodes[stack[--stackSize]];
+    uint32_t nodeIndex = (uint32_t)(&node - &m_nodes[0]);
+    if (_intersectNode(node.bounds, packet, 1, &distance) == 0) {
+      continue;
+    }
+    if (node.isLeaf()) {
+      for (uint32_t t = node.offset; t < node.offset + node.count; t++) {
+        // Reset the distance each time so that every crossing is counted
+        // rather than only the nearest
+        triangle = BVH_NO_HIT;
+        _intersectTriangle(m_triangles[t], t, packet, 1, &distance, &u, &v, &triangle);
+        if (triangle != BVH_NO_HIT) {
+          crossings++;
+          distance = std::numeric_limits<float>::max();
+        }
+      }
+      continue;
+    }
+    assert(stackSize + 2 <= BVH_MAX_DEPTH);
+    stack[stackSize++] = node.offset;
+    stack[stackSize++] = nodeIndex + 1;
+  }
+  return crossings;
+}
+
+bool BVH::containsPoint(const Vector3& p) const
+{
+  HYDRA_PROFILE_SCOPE("BVH::containsPoint");
+  if (m_nodeCount == 0 || !m_nodes[0].bounds.contains(p)) {
+    return false;
+  }
+  // A single ray can report the wrong parity when it grazes an edge or a
+  // vertex; that is unlikely to happen for all three rays at once.  The
+  // directions are deliberately skewed, as axis-aligned rays would pass
+  // exactly through the shared diagonal of axis-aligned quads.
+  static const Vector3 directions[3] = {
+    Vector3::Create(0.8235f, 0.3821f, 0.4194f),
+    Vector3::Create(-0.3379f, 0.8842f, 0.3227f),
+    Vector3::Create(-0.2602f, -0.4113f, 0.8735f)
+  };
+  int insideVotes = 0;
+  for (int i = 0; i < 3; i++) {
+    insideVotes += countCrossings(p, directions[i]) & 1;
+  }
+  return insideVotes >= 2;
+}
+
+bool BVH::intersects(const BVH& other) const
+{
+  HYDRA_PROFILE_SCOPE("BVH::intersects");
+  return overlap(other, false, true, nullptr);
+}
+
+void BVH::intersectingTriangles(const BVH& other, std::vector<std::pair<uint32_t, uint32_t> >& pairs) const
+{
+  HYDRA_PROFILE_SCOPE("BVH::intersectingTriangles");
+  overlap(other, false, false, &pairs);
+}
+
+void BVH::selfIntersectingTriangles(std::vector<std::pair<uint32_t, uint32_t> >& pairs) const
+{
+  HYDRA_PROFILE_SCOPE("BVH::selfIntersectingTriangles");
+  overlap(*this, true, false, &pairs);
+}
+
+bool BVH::overlap(const BVH& other, bool self, bool firstOnly, std::vector<std::pair<uint32_t, uint32_t> >* pairs) const
+{
+  if (m_nodeCount == 0 || other.m_nodeCount == 0) {
+    return false;
+  }
+
+  // Simultaneous descent over pairs of nodes with overlapping bounds.  For
+  // self intersection, a node paired with itself expands to its children
+  // paired with themselves and with each other, so that each pair of
+  // triangles is visited once.
+  struct StackEntry
+  {
+    uint32_t a;
+    uint32_t b;
+  } stack[BVH_MAX_DEPTH * 4];
+  int stackSize = 0;
+  stack[stackSize].a = 0;
+  stack[stackSize].b = 0;
+  stackSize++;
+
+  bool found = false;
+  while (stackSize > 0) {
+    stackSize--;
+    uint32_t indexA = stack[stackSize].a;
+    uint32_t indexB = stack[stackSize].b;
+    const BVHNode& nodeA = m_nodes[indexA];
+    const BVHNode& nodeB = other.m_nodes[indexB];
+
+    if (self && indexA == indexB) {
+      if (nodeA.isLeaf()) {
+        for (uint32_t i = nodeA.offset; i < nodeA.offset + nodeA.count; i++) {
+          for (uint32_t j = i + 1; j < nodeA.offset + nodeA.count; j++) {
+            if (!_sharesVertex(m_triangles[i], m_triangles[j]) && m_triangles[i].intersects(m_triangles[j])) {
+              found = true;
+              pairs->push_back(std::make_pair(KRMIN(m_triangleIndices[i], m_triangleIndices[j]), KRMAX(m_triangleIndices[i], m_triangleIndices[j])));
+            }
+          }
+        }
+        continue;
+      }
+      assert(stackSize + 3 <= BVH_MAX_DEPTH * 4);
+      stack[stackSize].a = indexA + 1;
+      stack[stackSize].b = nodeA.offset;
+      stackSize++;
+      stack[stackSize].a = indexA + 1;
+      stack[stackSize].b = indexA + 1;
+      stackSize++;
+      stack[stackSize].a = nodeA.offset;
+      stack[stackSize].b = nodeA.offset;
+      stackSize++;
+      continue;
+    }
+
+    if (!nodeA.bounds.intersects(nodeB.bounds)) {
+      continue;
+    }
+
+    if (nodeA.isLeaf() && nodeB.isLeaf()) {
+      for (uint32_t i = nodeA.offset; i < nodeA.offset + nodeA.count; i++) {
+        for (uint32_t j = nodeB.offset; j < nodeB.offset + nodeB.count; j++) {
+          const Triangle3& triA = m_triangles[i];
+          const Triangle3& triB = other.m_triangles[j];
+          if (self && _sharesVertex(triA, triB)) {
+            continue;
+          }
+          if (!triA.intersects(triB)) {
+            continue;
+          }
+          found = true;
+          if (firstOnly) {
+            return true;
+          }
+          uint32_t sourceA = m_triangleIndices[i];
+          uint32_t sourceB = other.m_triangleIndices[j];
+          if (self && sourceB < sourceA) {
+            pairs->push_back(std::make_pair(sourceB, sourceA));
+          } else {
+            pairs->push_back(std::make_pair(sourceA, sourceB));
+          }
+        }
+      }
+      continue;
+    }
+
+    // Descend into the larger node, keeping the pair of boxes balanced
+    assert(stackSize + 2 <= BVH_MAX_DEPTH * 4);
+    if (!nodeA.isLeaf() && (nodeB.isLeaf() || nodeA.bounds.volume() >= nodeB.bounds.volume())) {
+      stack[stackSize].a = nodeA.offset;
+      stack[stackSize].b = indexB;
+      stackSize++;
+      stack[stackSize].a = indexA + 1;
+      stack[stackSize].b = indexB;
+      stackSize++;
+    } else {
+      stack[stackSize].a = indexA;
+      stack[stackSize].b = nodeB.offset;
+      stackSize++;
+      stack[stackSize].a = indexA;
+      stack[stackSize].b = indexB + 1;
+      stackSize++;
+    }
+  }
+  return found;
+}
+
+} // namespace hydra
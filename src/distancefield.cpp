@@ -0,0 +1,203 @@
+//
+//  distancefield.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+#include "assert.h"
+#include "krhelpers.h"
+
+#include <limits>
+
+namespace hydra {
+
+namespace {
+
+void _bakeSlice(const BVH& mesh, const DistanceField& field, float* values, int z)
+{
+  Vector3i resolution = field.getResolution();
+  float cellDiagonal = field.getCellSize().magnitude();
+  float* slice = values + (size_t)z * resolution.x * resolution.y;
+  float searchRadius = std::numeric_limits<float>::max();
+  for (int y = 0; y < resolution.y; y++) {
+    for (int x = 0; x < resolution.x; x++) {
+      Vector3 p = field.cellCenter(Vector3i::Create(x, y, z));
+      HitInfo hit;
+      float distance = std::numeric_limits<float>::max();
+      if (mesh.closestPoint(p, searchRadius, hit) || mesh.closestPoint(p, hit)) {
+        distance = hit.getDistance();
+        // Adjacent cells are close together, so the previous distance plus
+        // the cell spacing bounds the search for the next one.
+        searchRadius = distance + cellDiagonal;
+
+        // Inside the face, the side of the triangle's plane gives the sign.
+        // Near edges and vertices the faces disagree, so fall back to
+        // counting crossings.
+        const float EDGE_EPSILON = 0.001f;
+        Vector2 b = hit.getBarycentric();
+        bool onFace = b.x > EDGE_EPSILON && b.y > EDGE_EPSILON && b.x + b.y < 1.0f - EDGE_EPSILON;
+        bool inside;
+        if (onFace && distance > 0.0f) {
+          inside = Vector3::Dot(p - hit.getPosition(), hit.getNormal()) < 0.0f;
+        } else {
+          inside = mesh.containsPoint(p);
+        }
+        if (inside) {
+          distance = -distance;
+        }
+      }
+      slice[y * resolution.x + x] = distance;
+    }
+  }
+}
+
+} // anonymous namespace
+
+DistanceField::DistanceField()
+{
+  clear();
+}
+
+DistanceField::~DistanceField()
+{
+
+}
+
+void DistanceField::clear()
+{
+  m_bounds = AABB::Zero();
+  m_resolution = Vector3i::Zero();
+  m_cellSize = Vector3::Zero();
+  m_values.clear();
+}
+
+void DistanceField::bake(const BVH& mesh, const AABB& bounds, const Vector3i& resolution, unsigned int threadCount)
+{
+  if (threadCount == 0) {
+    threadCount = KRMAX(std::thread::hardware_concurrency(), 1u);
+  }
+  ThreadPool pool(KRMIN(threadCount, (unsigned int)KRMAX(resolution.z, 1)));
+  bake(mesh, bounds, resolution, pool);
+}
+
+void DistanceField::bake(const BVH& mesh, const AABB& bounds, const Vector3i& resolution, Scheduler& scheduler)
+{
+  HYDRA_PROFILE_SCOPE("DistanceField::bake");
+  assert(resolution.x > 0 && resolution.y > 0 && resolution.z > 0);
+  m_bounds = bounds;
+  m_resolution = resolution;
+  Vector3 size = bounds.size();
+  m_cellSize = Vector3::Create(size.x / resolution.x, size.y / resolution.y, size.z / resolution.z);
+  m_values.resize((size_t)resolution.x * resolution.y * resolution.z);
+
+  // Slices are handed out one at a time, as their cost varies with the
+  // amount of geometry nearby
+  float* values = &m_values[0];
+  scheduler.parallelFor(0, resolution.z, 1, [&mesh, this, values](size_t begin, size_t end) {
+    for (size_t z = begin; z < end; z++) {
+      _bakeSlice(mesh, *this, values, (int)z);
+    }
+  });
+}
+
+AABB DistanceField::getBounds() const
+{
+  return m_bounds;
+}
+
+Vector3i DistanceField::getResolution() const
+{
+  return m_resolution;
+}
+
+Vector3 DistanceField::getCellSize() const
+{
+  return m_cellSize;
+}
+
+Vector3 DistanceField::cellCenter(const Vector3i& cell) const
+{
+  return m_bounds.min + Vector3::Create((cell.x + 0.5f) * m_cellSize.x,
+                                        (cell.y + 0.5f) * m_cellSize.y,
+                                        (cell.z + 0.5f) * m_cellSize.z);
+}
+
+size_t DistanceField::cellIndex(int x, int y, int z) const
+{
+  return ((size_t)z * m_resolution.y + y) * m_resolution.x + x;
+}
+
+float DistanceField::getValue(const Vector3i& cell) const
+{
+  return m_values[cellIndex(cell.x, cell.y, cell.z)];
+}
+
+const float* DistanceField::getValues() const
+{
+  return m_values.empty() ? NULL : &m_values[0];
+}
+
+float DistanceField::sample(const Vector3& p) const
+{
+  HYDRA_PROFILE_SCOPE("DistanceField::sample");
+  assert(!m_values.empty());
+
+  // Continuous grid coordinates, with cell centers at integer positions
+  float fx = KRCLAMP((p.x - m_bounds.min.x) / m_cellSize.x - 0.5f, 0.0f, (float)(m_resolution.x - 1));
+  float fy = KRCLAMP((p.y - m_bounds.min.y) / m_cellSize.y - 0.5f, 0.0f, (float)(m_resolution.y - 1));
+  float fz = KRCLAMP((p.z - m_bounds.min.z) / m_cellSize.z - 0.5f, 0.0f, (float)(m_resolution.z - 1));
+  int x0 = (int)fx;
+  int y0 = (int)fy;
+  int z0 = (int)fz;
+  int x1 = KRMIN(x0 + 1, m_resolution.x - 1);
+  int y1 = KRMIN(y0 + 1, m_resolution.y - 1);
+  int z1 = KRMIN(z0 + 1, m_resolution.z - 1);
+  float tx = fx - x0;
+  float ty = fy - y0;
+  float tz = fz - z0;
+
+  float c00 = Lerp(m_values[cellIndex(x0, y0, z0)], m_values[cellIndex(x1, y0, z0)], tx);
+  float c10 = Lerp(m_values[cellIndex(x0, y1, z0)], m_values[cellIndex(x1, y1, z0)], tx);
+  float c01 = Lerp(m_values[cellIndex(x0, y0, z1)], m_values[cellIndex(x1, y0, z1)], tx);
+  float c11 = Lerp(m_values[cellIndex(x0, y1, z1)], m_values[cellIndex(x1, y1, z1)], tx);
+  return Lerp(Lerp(c00, c10, ty), Lerp(c01, c11, ty), tz);
+}
+
+Vector3 DistanceField::gradient(const Vector3& p) const
+{
+  HYDRA_PROFILE_SCOPE("DistanceField::gradient");
+  // Central differences, one cell apart
+  Vector3 h = m_cellSize * 0.5f;
+  return Vector3::Create(
+    (sample(p + Vector3::Create(h.x, 0.0f, 0.0f)) - sample(p - Vector3::Create(h.x, 0.0f, 0.0f))) / m_cellSize.x,
+    (sample(p + Vector3::Create(0.0f, h.y, 0.0f)) - sample(p - Vector3::Create(0.0f, h.y, 0.0f))) / m_cellSize.y,
+    (sample(p + Vector3::Create(0.0f, 0.0f, h.z)) - sample(p - Vector3::Create(0.0f, 0.0f, h.z))) / m_cellSize.z);
+}
+
+} // namespace hydra
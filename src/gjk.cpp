@@ -0,0 +1,632 @@
+//
+//  gjk.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+#include "krhelpers.h"
+
+namespace hydra {
+
+namespace {
+
+const int GJK_MAX_ITERATIONS = 64;
+const float GJK_TOLERANCE = 0.000001f;
+
+const int EPA_MAX_VERTICES = 128; // Each iteration adds one vertex to the initial tetrahedron
+const int EPA_MAX_FACES = EPA_MAX_VERTICES * 2;
+const int EPA_MAX_EDGES = EPA_MAX_FACES;
+const float EPA_TOLERANCE = 0.0001f;
+
+struct SimplexVertex
+{
+  Vector3 w; // a - b, a point of the Minkowski difference
+  Vector3 a;
+  Vector3 b;
+  Vector3 dir;
+};
+
+// Returns the support point of A - B in direction dir
+SimplexVertex _support(const ConvexShape& a, const ConvexShape& b, const Vector3& dir)
+{
+  SimplexVertex v;
+  v.dir = dir;
+  v.a = a.support(dir);
+  v.b = b.support(-dir);
+  v.w = v.a - v.b;
+  return v;
+}
+
+Vector3 _modelToLocalDirection(const Matrix4& m, const Vector3& dir)
+{
+  // Multiplies dir by the transpose of the matrix's linear part.  The support
+  // point of a linearly transformed set in direction d is the transformed
+  // support point of the original set in direction transpose(M) * d.
+  return Vector3::Create(
+    dir.x * m.c[0] + dir.y * m.c[1] + dir.z * m.c[2],
+    dir.x * m.c[4] + dir.y * m.c[5] + dir.z * m.c[6],
+    dir.x * m.c[8] + dir.y * m.c[9] + dir.z * m.c[10]);
+}
+
+void _removeVertex(SimplexVertex* simplex, float* lambda, int& count, int i)
+{
+  for (int j = i; j < count - 1; j++) {
+    simplex[j] = simplex[j + 1];
+    lambda[j] = lambda[j + 1];
+  }
+  count--;
+}
+
+Vector3 _closestOnTriangle(SimplexVertex* simplex, float* lambda, int& count)
+{
+  // Reuses the Voronoi region classification of Triangle3, then drops the
+  // vertices that do not contribute to the closest point
+  Vector2 barycentric;
+  Vector3 v = Triangle3::Create(simplex[0].w, simplex[1].w, simplex[2].w).closestPointOnTriangle(Vector3::Zero(), barycentric);
+  lambda[0] = 1.0f - barycentric.x - barycentric.y;
+  lambda[1] = barycentric.x;
+  lambda[2] = barycentric.y;
+  for (int i = 2; i >= 0; i--) {
+    if (lambda[i] <= 0.0f && count > 1) {
+      _removeVertex(simplex, lambda, count, i);
+    }
+  }
+  return v;
+}
+
+// Finds the point of the simplex closest to the origin, reducing the simplex
+// to the smallest sub-simplex that contains it.  Returns false if the origin
+// is enclosed by a tetrahedron.
+bool _closestOnSimplex(SimplexVertex* simplex, float* lambda, int& count, Vector3& v)
+{
+  switch (count) {
+  case 1:
+    lambda[0] = 1.0f;
+    v = simplex[0].w;
+    return true;
+  case 2:
+  {
+    Vector3 ab = simplex[1].w - simplex[0].w;
+    float len2 = ab.sqrMagnitude();
+    float t = len2 > 0.0f ? -Vector3::Dot(simplex[0].w, ab) / len2 : 0.0f;
+    if (t <= 0.0f) {
+      count = 1;
+    } else if (t >= 1.0f) {
+      simplex[0] = simplex[1];
+      count = 1;
+    }
+    if (count == 1) {
+      lambda[0] = 1.0f;
+      v = simplex[0].w;
+    } else {
+      lambda[0] = 1.0f - t;
+      lambda[1] = t;
+      v = simplex[0].w + ab * t;
+    }
+    return true;
+  }
+  case 3:
+    v = _closestOnTriangle(simplex, lambda, count);
+    return true;
+  default:
+  {
+    // The origin is inside the tetrahedron unless it lies outside one of the
+    // faces.  Of the faces that it lies outside of, the closest one wins.
+    static const int faces[4][4] = { { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+    bool outside = false;
+    float bestDistance = std::numeric_limits<float>::max();
+    SimplexVertex bestSimplex[3];
+    float bestLambda[3];
+    int bestCount = 0;
+    for (int f = 0; f < 4; f++) {
+      const Vector3& a = simplex[faces[f][0]].w;
+      const Vector3& b = simplex[faces[f][1]].w;
+      const Vector3& c = simplex[faces[f][2]].w;
+      const Vector3& d = simplex[faces[f][3]].w;
+      Vector3 n = Vector3::Cross(b - a, c - a);
+      float originSide = -Vector3::Dot(n, a);
+      float oppositeSide = Vector3::Dot(n, d - a);
+      // A flat tetrahedron encloses nothing; treat each face as a candidate
+      if (originSide * oppositeSide > 0.0f && oppositeSide * oppositeSide > GJK_TOLERANCE * GJK_TOLERANCE * n.sqrMagnitude()) {
+        continue;
+      }
+      outside = true;
+      SimplexVertex faceSimplex[3] = { simplex[faces[f][0]], simplex[faces[f][1]], simplex[faces[f][2]] };
+      float faceLambda[3];
+      int faceCount = 3;
+      Vector3 faceV = _closestOnTriangle(faceSimplex, faceLambda, faceCount);
+      float distance = faceV.sqrMagnitude();
+      if (distance < bestDistance) {
+        bestDistance = distance;
+        bestCount = faceCount;
+        v = faceV;
+        for (int i = 0; i < faceCount; i++) {
+          bestSimplex[i] = faceSimplex[i];
+          bestLambda[i] = faceLambda[i];
+        }
+      }
+    }
+    if (!outside) {
+      return false;
+    }
+    count = bestCount;
+    for (int i = 0; i < count; i++) {
+      simplex[i] = bestSimplex[i];
+      lambda[i] = bestLambda[i];
+    }
+    return true;
+  }
+  }
+}
+
+enum class GJKStatus
+{
+  SEPARATED,
+  OVERLAPPING,
+  UNRESOLVED // Out of iterations without a separating axis or an enclosing simplex
+};
+
+// Runs GJK.  On return, the simplex holds the final search directions and, if
+// the shapes overlap, the vertices of a simplex that encloses (or touches) the
+// origin.  For separated and unresolved shapes, result holds the closest
+// points of the last simplex.
+GJKStatus _gjk(const ConvexShape& a, const ConvexShape& b, GJKSimplex& cache, bool earlyOut, SimplexVertex* simplex, int& count, GJKResult& result)
+{
+  float lambda[4];
+
+  // Warm start from the directions of the previous query's simplex
+  count = 0;
+  for (int i = 0; i < cache.count && i < 4; i++) {
+    SimplexVertex vertex = _support(a, b, cache.dir[i]);
+    bool duplicate = false;
+    for (int j = 0; j < count; j++) {
+      duplicate |= simplex[j].w == vertex.w;
+    }
+    if (!duplicate) {
+      simplex[count++] = vertex;
+    }
+  }
+  if (count == 0) {
+    simplex[count++] = _support(a, b, Vector3::Right());
+  }
+
+  Vector3 v;
+  float previousDistance = std::numeric_limits<float>::max();
+  GJKStatus status = GJKStatus::UNRESOLVED;
+  int iteration;
+  for (iteration = 0; iteration < GJK_MAX_ITERATIONS; iteration++) {
+    if (!_closestOnSimplex(simplex, lambda, count, v)) {
+      status = GJKStatus::OVERLAPPING;
+      break;
+    }
+    float distance = v.sqrMagnitude();
+    if (distance <= GJK_TOLERANCE * GJK_TOLERANCE) {
+      status = GJKStatus::OVERLAPPING; // Origin touches the simplex
+      break;
+    }
+    status = GJKStatus::SEPARATED;
+    if (distance >= previousDistance) {
+      break; // No further progress is possible due to rounding
+    }
+    previousDistance = distance;
+
+    SimplexVertex w = _support(a, b, -v);
+    float progress = Vector3::Dot(v, w.w);
+    if (earlyOut && progress > 0.0f) {
+      break; // v is a separating axis
+    }
+    if (distance - progress <= GJK_TOLERANCE * distance) {
+      break; // Converged
+    }
+    bool duplicate = false;
+    for (int i = 0; i < count; i++) {
+      duplicate |= simplex[i].w == w.w;
+    }
+    if (duplicate) {
+      break;
+    }
+    simplex[count++] = w;
+    status = GJKStatus::UNRESOLVED;
+  }
+
+  if (status == GJKStatus::UNRESOLVED) {
+    // The last support point was added without being evaluated
+    if (!_closestOnSimplex(simplex, lambda, count, v) || v.sqrMagnitude() <= GJK_TOLERANCE * GJK_TOLERANCE) {
+      status = GJKStatus::OVERLAPPING;
+    }
+  }
+
+  cache.count = count;
+  for (int i = 0; i < count; i++) {
+    cache.dir[i] = simplex[i].dir;
+  }
+
+  result.iterations = iteration + 1;
+  if (status == GJKStatus::OVERLAPPING) {
+    return status;
+  }
+
+  result.pointA = Vector3::Zero();
+  result.pointB = Vector3::Zero();
+  for (int i = 0; i < count; i++) {
+    result.pointA += simplex[i].a * lambda[i];
+    result.pointB += simplex[i].b * lambda[i];
+  }
+  result.distance = v.magnitude();
+  result.normal = -v / result.distance;
+  return status;
+}
+
+// Grows a simplex that touches the origin into a tetrahedron that encloses it
+bool _expandSimplex(const ConvexShape& a, const ConvexShape& b, SimplexVertex* simplex, int& count)
+{
+  static const Vector3 axes[6] = {
+    Vector3::Create(1.0f, 0.0f, 0.0f), Vector3::Create(-1.0f, 0.0f, 0.0f),
+    Vector3::Create(0.0f, 1.0f, 0.0f), Vector3::Create(0.0f, -1.0f, 0.0f),
+    Vector3::Create(0.0f, 0.0f, 1.0f), Vector3::Create(0.0f, 0.0f, -1.0f)
+  };
+
+  if (count == 1) {
+    for (int i = 0; i < 6 && count == 1; i++) {
+      SimplexVertex vertex = _support(a, b, axes[i]);
+      if ((vertex.w - simplex[0].w).sqrMagnitude() > GJK_TOLERANCE) {
+        simplex[count++] = vertex;
+      }
+    }
+  }
+
+  if (count == 2) {
+    // Search perpendicular to the segment
+    Vector3 d = simplex[1].w - simplex[0].w;
+    int minorAxis = fabs(d.x) < fabs(d.y) ? (fabs(d.x) < fabs(d.z) ? 0 : 2) : (fabs(d.y) < fabs(d.z) ? 1 : 2);
+    Vector3 perp = Vector3::Cross(d, axes[minorAxis * 2]);
+    Vector3 perp2 = Vector3::Cross(d, perp);
+    Vector3 dirs[4] = { perp, -perp, perp2, -perp2 };
+    for (int i = 0; i < 4 && count == 2; i++) {
+      SimplexVertex vertex = _support(a, b, dirs[i]);
+      if (Vector3::Cross(vertex.w - simplex[0].w, d).sqrMagnitude() > GJK_TOLERANCE * d.sqrMagnitude()) {
+        simplex[count++] = vertex;
+      }
+    }
+  }
+
+  if (count == 3) {
+    Vector3 n = Vector3::Cross(simplex[1].w - simplex[0].w, simplex[2].w - simplex[0].w);
+    SimplexVertex vertex = _support(a, b, n);
+    if (fabs(Vector3::Dot(vertex.w - simplex[0].w, n)) <= GJK_TOLERANCE * n.magnitude()) {
+      vertex = _support(a, b, -n);
+    }
+    if (fabs(Vector3::Dot(vertex.w - simplex[0].w, n)) > GJK_TOLERANCE * n.magnitude()) {
+      simplex[count++] = vertex;
+    }
+  }
+
+  return count == 4;
+}
+
+struct EPAFace
+{
+  int v[3];
+  Vector3 normal;
+  float distance;
+  bool removed;
+};
+
+bool _initFace(EPAFace& face, const SimplexVertex* vertices, int a, int b, int c)
+{
+  face.v[0] = a;
+  face.v[1] = b;
+  face.v[2] = c;
+  face.removed = false;
+  Vector3 n = Vector3::Cross(vertices[b].w - vertices[a].w, vertices[c].w - vertices[a].w);
+  float length = n.magnitude();
+  if (length <= 0.0f) {
+    return false;
+  }
+  face.normal = n / length;
+  face.distance = Vector3::Dot(face.normal, vertices[a].w);
+  return true;
+}
+
+bool _epa(const ConvexShape& a, const ConvexShape& b, SimplexVertex* simplex, GJKResult& result)
+{
+  SimplexVertex vertices[EPA_MAX_VERTICES];
+  EPAFace faces[EPA_MAX_FACES];
+  int vertexCount = 4;
+  int faceCount = 0;
+  for (int i = 0; i < 4; i++) {
+    vertices[i] = simplex[i];
+  }
+
+  // Orient the tetrahedron so that its faces wind outwards
+  if (Vector3::Dot(Vector3::Cross(vertices[1].w - vertices[0].w, vertices[2].w - vertices[0].w), vertices[3].w - vertices[0].w) > 0.0f) {
+    SimplexVertex tmp = vertices[1];
+    vertices[1] = vertices[2];
+    vertices[2] = tmp;
+  }
+  static const int tetrahedron[4][3] = { { 0, 1, 2 }, { 0, 3, 1 }, { 0, 2, 3 }, { 1, 3, 2 } };
+  for (int f = 0; f < 4; f++) {
+    if (!_initFace(faces[faceCount++], vertices, tetrahedron[f][0], tetrahedron[f][1], tetrahedron[f][2])) {
+      return false;
+    }
+  }
+
+  // Every exit from the loop happens before the faces are modified, so that
+  // closest still refers to the face it was chosen as
+  const EPAFace* closest = NULL;
+  int iteration;
+  for (iteration = 0; ; iteration++) {
+    closest = NULL;
+    for (int f = 0; f < faceCount; f++) {
+      if (!faces[f].removed && (closest == NULL || faces[f].distance < closest->distance)) {
+        closest = &faces[f];
+      }
+    }
+    if (closest == NULL) {
+      return false;
+    }
+    if (vertexCount == EPA_MAX_VERTICES) {
+      break; // Out of vertices; the closest face is the best estimate
+    }
+
+    SimplexVertex w = _support(a, b, closest->normal);
+    if (Vector3::Dot(w.w, closest->normal) - closest->distance <= EPA_TOLERANCE) {
+      break; // The closest face lies on the boundary of the Minkowski difference
+    }
+    int newVertex = vertexCount++;
+    vertices[newVertex] = w;
+
+    // Remove every face that can see the new vertex, keeping the edges of the
+    // resulting hole.  Edges shared by two removed faces cancel out.
+    int edges[EPA_MAX_EDGES][2];
+    int edgeCount = 0;
+    for (int f = 0; f < faceCount; f++) {
+      if (faces[f].removed || Vector3::Dot(faces[f].normal, w.w - vertices[faces[f].v[0]].w) <= 0.0f) {
+        continue;
+      }
+      faces[f].removed = true;
+      for (int e = 0; e < 3; e++) {
+        int e0 = faces[f].v[e];
+        int e1 = faces[f].v[(e + 1) % 3];
+        bool shared = false;
+        for (int i = 0; i < edgeCount; i++) {
+          if (edges[i][0] == e1 && edges[i][1] == e0) {
+            edges[i][0] = edges[edgeCount - 1][0];
+            edges[i][1] = edges[edgeCount - 1][1];
+            edgeCount--;
+            shared = true;
+            break;
+          }
+        }
+        if (!shared && edgeCount < EPA_MAX_EDGES) {
+          edges[edgeCount][0] = e0;
+          edges[edgeCount][1] = e1;
+          edgeCount++;
+        }
+      }
+    }
+
+    // Compact the face list, then patch the hole with faces fanning out from
+    // the new vertex
+    int kept = 0;
+    for (int f = 0; f < faceCount; f++) {
+      if (!faces[f].removed) {
+        faces[kept++] = faces[f];
+      }
+    }
+    faceCount = kept;
+    for (int i = 0; i < edgeCount && faceCount < EPA_MAX_FACES; i++) {
+      if (_initFace(faces[faceCount], vertices, edges[i][0], edges[i][1], newVertex)) {
+        faceCount++;
+      }
+    }
+  }
+
+  // The contact points are found from the barycentric coordinates of the
+  // origin's projection on the closest face
+  const SimplexVertex& va = vertices[closest->v[0]];
+  const SimplexVertex& vb = vertices[closest->v[1]];
+  const SimplexVertex& vc = vertices[closest->v[2]];
+  Vector2 barycentric;
+  Triangle3::Create(va.w, vb.w, vc.w).closestPointOnTriangle(closest->normal * closest->distance, barycentric);
+  float l0 = 1.0f - barycentric.x - barycentric.y;
+  result.pointA = va.a * l0 + vb.a * barycentric.x + vc.a * barycentric.y;
+  result.pointB = va.b * l0 + vb.b * barycentric.x + vc.b * barycentric.y;
+  result.normal = closest->normal;
+  result.distance = closest->distance;
+  result.iterations += iteration + 1;
+  return true;
+}
+
+} // anonymous namespace
+
+ConvexShape::~ConvexShape()
+{
+
+}
+
+ConvexHull::ConvexHull(const Vector3* points, size_t count)
+  : m_points(points)
+  , m_count(count)
+{
+  m_modelMatrix.init();
+}
+
+ConvexHull::ConvexHull(const Vector3* points, size_t count, const Matrix4& modelMatrix)
+  : m_points(points)
+  , m_count(count)
+  , m_modelMatrix(modelMatrix)
+{
+
+}
+
+Vector3 ConvexHull::support(const Vector3& dir) const
+{
+  Vector3 localDir = _modelToLocalDirection(m_modelMatrix, dir);
+  size_t best = 0;
+  float bestDot = -std::numeric_limits<float>::max();
+  for (size_t i = 0; i < m_count; i++) {
+    float d = Vector3::Dot(m_points[i], localDir);
+    if (d > bestDot) {
+      bestDot = d;
+      best = i;
+    }
+  }
+  return Matrix4::Dot(m_modelMatrix, m_points[best]);
+}
+
+ConvexBox::ConvexBox(const AABB& box)
+  : m_box(box)
+{
+  m_modelMatrix.init();
+}
+
+ConvexBox::ConvexBox(const AABB& box, const Matrix4& modelMatrix)
+  : m_box(box)
+  , m_modelMatrix(modelMatrix)
+{
+
+}
+
+Vector3 ConvexBox::support(const Vector3& dir) const
+{
+  Vector3 localDir = _modelToLocalDirection(m_modelMatrix, dir);
+  return Matrix4::Dot(m_modelMatrix, Vector3::Create(
+    localDir.x >= 0.0f ? m_box.max.x : m_box.min.x,
+    localDir.y >= 0.0f ? m_box.max.y : m_box.min.y,
+    localDir.z >= 0.0f ? m_box.max.z : m_box.min.z));
+}
+
+ConvexSphere::ConvexSphere(const Vector3& center, float radius)
+  : m_center(center)
+  , m_radius(radius)
+{
+
+}
+
+Vector3 ConvexSphere::support(const Vector3& dir) const
+{
+  float length = dir.magnitude();
+  if (length <= 0.0f) {
+    return m_center + Vector3::Create(m_radius, 0.0f, 0.0f);
+  }
+  return m_center + dir * (m_radius / length);
+}
+
+ConvexCapsule::ConvexCapsule(const Vector3& point1, const Vector3& point2, float radius)
+  : m_point1(point1)
+  , m_point2(point2)
+  , m_radius(radius)
+{
+
+}
+
+Vector3 ConvexCapsule::support(const Vector3& dir) const
+{
+  Vector3 p = Vector3::Dot(m_point2 - m_point1, dir) > 0.0f ? m_point2 : m_point1;
+  float length = dir.magnitude();
+  if (length <= 0.0f) {
+    return p + Vector3::Create(m_radius, 0.0f, 0.0f);
+  }
+  return p + dir * (m_radius / length);
+}
+
+ConvexTriangle::ConvexTriangle(const Triangle3& triangle)
+  : m_triangle(triangle)
+{
+
+}
+
+Vector3 ConvexTriangle::support(const Vector3& dir) const
+{
+  float d0 = Vector3::Dot(m_triangle.vert[0], dir);
+  float d1 = Vector3::Dot(m_triangle.vert[1], dir);
+  float d2 = Vector3::Dot(m_triangle.vert[2], dir);
+  if (d0 >= d1 && d0 >= d2) {
+    return m_triangle.vert[0];
+  }
+  return d1 >= d2 ? m_triangle.vert[1] : m_triangle.vert[2];
+}
+
+void GJKSimplex::init()
+{
+  count = 0;
+}
+
+GJKSimplex GJKSimplex::Create()
+{
+  GJKSimplex r;
+  r.init();
+  return r;
+}
+
+bool GJK::Intersect(const ConvexShape& a, const ConvexShape& b, GJKSimplex& simplex)
+{
+  HYDRA_PROFILE_SCOPE("GJK::Intersect");
+  SimplexVertex vertices[4];
+  int count;
+  GJKResult result;
+  return _gjk(a, b, simplex, true, vertices, count, result) != GJKStatus::SEPARATED;
+}
+
+bool GJK::Distance(const ConvexShape& a, const ConvexShape& b, GJKSimplex& simplex, GJKResult& result)
+{
+  HYDRA_PROFILE_SCOPE("GJK::Distance");
+  SimplexVertex vertices[4];
+  int count;
+  return _gjk(a, b, simplex, false, vertices, count, result) == GJKStatus::SEPARATED;
+}
+
+bool GJK::Penetration(const ConvexShape& a, const ConvexShape& b, GJKSimplex& simplex, GJKResult& result)
+{
+  HYDRA_PROFILE_SCOPE("GJK::Penetration");
+  SimplexVertex vertices[4];
+  int count;
+  GJKStatus status = _gjk(a, b, simplex, true, vertices, count, result);
+  if (status == GJKStatus::SEPARATED) {
+    return false;
+  }
+  if (status == GJKStatus::UNRESOLVED) {
+    // No separating axis was found, but the origin is not enclosed either, so
+    // the shapes are reported as touching at the closest points found
+    result.distance = 0.0f;
+    return true;
+  }
+  if (!_expandSimplex(a, b, vertices, count)) {
+    // The Minkowski difference is flat, so the shapes only touch
+    result.pointA = vertices[0].a;
+    result.pointB = vertices[0].b;
+    result.normal = Vector3::Zero();
+    result.distance = 0.0f;
+    return true;
+  }
+  return _epa(a, b, vertices, result);
+}
+
+} // namespace hydra
@@ -33,38 +33,57 @@
 
 namespace hydra {
 
-HitInfo::HitInfo()
+void HitInfo::init()
 {
   m_position = Vector3::Zero();
   m_normal = Vector3::Zero();
+  m_barycentric = Vector2::Zero();
   m_distance = 0.0f;
-  m_node = NULL;
+  m_primitiveId = INVALID_ID;
+  m_instanceId = INVALID_ID;
+  m_hit = 0;
 }
 
-HitInfo::HitInfo(const Vector3& position, const Vector3& normal, const float distance, KRNode* node)
+HitInfo HitInfo::Create()
 {
-  m_position = position;
-  m_normal = normal;
-  m_distance = distance;
-  m_node = node;
+  HitInfo r;
+  r.init();
+  return r;
+}
+
+void HitInfo::init(const Vector3& position, const Vector3& normal, const float distance)
+{
+  init(position, normal, distance, Vector2::Zero(), INVALID_ID, INVALID_ID);
+}
+
+HitInfo HitInfo::Create(const Vector3& position, const Vector3& normal, const float distance)
+{
+  HitInfo r;
+  r.init(position, normal, distance);
+  return r;
 }
 
-HitInfo::HitInfo(const Vector3& position, const Vector3& normal, const float distance)
+void HitInfo::init(const Vector3& position, const Vector3& normal, const float distance, const Vector2& barycentric, uint32_t primitiveId, uint32_t instanceId)
 {
   m_position = position;
   m_normal = normal;
+  m_barycentric = barycentric;
   m_distance = distance;
-  m_node = NULL;
+  m_primitiveId = primitiveId;
+  m_instanceId = instanceId;
+  m_hit = 1;
 }
 
-HitInfo::~HitInfo()
+HitInfo HitInfo::Create(const Vector3& position, const Vector3& normal, const float distance, const Vector2& barycentric, uint32_t primitiveId, uint32_t instanceId)
 {
-
+  HitInfo r;
+  r.init(position, normal, distance, barycentric, primitiveId, instanceId);
+  return r;
 }
 
 bool HitInfo::didHit() const
 {
-  return m_normal != Vector3::Zero();
+  return m_hit != 0;
 }
 
 Vector3 HitInfo::getPosition() const
@@ -82,19 +101,24 @@ float HitInfo::getDistance() const
   return m_distance;
 }
 
-KRNode* HitInfo::getNode() const
+Vector2 HitInfo::getBarycentric() const
 {
-  return m_node;
+  return m_barycentric;
 }
 
-HitInfo& HitInfo::operator =(const HitInfo& b)
+uint32_t HitInfo::getPrimitiveId() const
 {
-  m_position = b.m_position;
-  m_normal = b.m_normal;
-  m_distance = b.m_distance;
-  m_node = b.m_node;
-  return *this;
+  return m_primitiveId;
 }
 
-} // namespace hydra
+uint32_t HitInfo::getInstanceId() const
+{
+  return m_instanceId;
+}
 
+void HitInfo::setInstanceId(uint32_t instanceId)
+{
+  m_instanceId = instanceId;
+}
+
+} // namespace hydra
@@ -0,0 +1,193 @@
+//
+//  indexedmesh.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+#include "assert.h"
+
+namespace hydra {
+
+IndexedMesh::IndexedMesh()
+{
+  clear();
+}
+
+IndexedMesh::~IndexedMesh()
+{
+
+}
+
+void IndexedMesh::set(const Vector3* vertices, size_t vertexCount, const uint32_t* indices, size_t indexCount)
+{
+  HYDRA_PROFILE_SCOPE("IndexedMesh::set");
+  assert(indexCount % 3 == 0);
+  m_vertices.assign(vertices, vertices + vertexCount);
+  m_indices.assign(indices, indices + indexCount);
+  m_cacheValid = false;
+}
+
+void IndexedMesh::clear()
+{
+  m_vertices.clear();
+  m_indices.clear();
+  m_edges.clear();
+  m_normals.clear();
+  m_triangleBounds.clear();
+  m_bounds = AABB::Zero();
+  m_cacheValid = true;
+}
+
+size_t IndexedMesh::vertexCount() const
+{
+  return m_vertices.size();
+}
+
+size_t IndexedMesh::triangleCount() const
+{
+  return m_indices.size() / 3;
+}
+
+const Vector3* IndexedMesh::getVertices() const
+{
+  return m_vertices.empty() ? nullptr : &m_vertices[0];
+}
+
+const uint32_t* IndexedMesh::getIndices() const
+{
+  return m_indices.empty() ? nullptr : &m_indices[0];
+}
+
+const Vector3& IndexedMesh::getVertex(size_t index) const
+{
+  return m_vertices[index];
+}
+
+void IndexedMesh::setVertex(size_t index, const Vector3& v)
+{
+  m_vertices[index] = v;
+  m_cacheValid = false;
+}
+
+void IndexedMesh::weld(float epsilon)
+{
+  Arena scratch;
+  weld(epsilon, scratch);
+}
+
+void IndexedMesh::weld(float epsilon, Arena& scratch)
+{
+  HYDRA_PROFILE_SCOPE("IndexedMesh::weld");
+  std::vector<Vector3> weldedVertices;
+  std::vector<uint32_t> remap;
+  VertexWelder::Weld(getVertices(), m_vertices.size(), epsilon, weldedVertices, remap, scratch);
+  for (size_t i = 0; i < m_indices.size(); i++) {
+    m_indices[i] = remap[m_indices[i]];
+  }
+  m_vertices.swap(weldedVertices);
+  m_cacheValid = false;
+}
+
+Triangle3 IndexedMesh::getTriangle(size_t triangle) const
+{
+  const uint32_t* index = &m_indices[triangle * 3];
+  return Triangle3::Create(m_vertices[index[0]], m_vertices[index[1]], m_vertices[index[2]]);
+}
+
+void IndexedMesh::getTriangles(std::vector<Triangle3>& triangles) const
+{
+  HYDRA_PROFILE_SCOPE("IndexedMesh::getTriangles");
+  size_t count = triangleCount();
+  triangles.resize(count);
+  for (size_t i = 0; i < count; i++) {
+    triangles[i] = getTriangle(i);
+  }
+}
+
+const Vector3& IndexedMesh::getEdge1(size_t triangle) const
+{
+  updateCaches();
+  return m_edges[triangle * 2];
+}
+
+const Vector3& IndexedMesh::getEdge2(size_t triangle) const
+{
+  updateCaches();
+  return m_edges[triangle * 2 + 1];
+}
+
+const Vector3& IndexedMesh::getNormal(size_t triangle) const
+{
+  updateCaches();
+  return m_normals[triangle];
+}
+
+const AABB& IndexedMesh::getTriangleBounds(size_t triangle) const
+{
+  updateCaches();
+  return m_triangleBounds[triangle];
+}
+
+AABB IndexedMesh::getBounds() const
+{
+  updateCaches();
+  return m_bounds;
+}
+
+void IndexedMesh::updateCaches() const
+{
+  if (m_cacheValid) {
+    return;
+  }
+  HYDRA_PROFILE_SCOPE("IndexedMesh::updateCaches");
+  size_t count = triangleCount();
+  m_edges.resize(count * 2);
+  m_normals.resize(count);
+  m_triangleBounds.resize(count);
+  m_bounds = count > 0 ? AABB::Create(Vector3::Max(), Vector3::Min()) : AABB::Zero();
+  for (size_t i = 0; i < count; i++) {
+    const uint32_t* index = &m_indices[i * 3];
+    const Vector3& v0 = m_vertices[index[0]];
+    const Vector3& v1 = m_vertices[index[1]];
+    const Vector3& v2 = m_vertices[index[2]];
+    Vector3 edge1 = v1 - v0;
+    Vector3 edge2 = v2 - v0;
+    m_edges[i * 2] = edge1;
+    m_edges[i * 2 + 1] = edge2;
+    Vector3 normal = Vector3::Cross(edge1, edge2);
+    float length = normal.magnitude();
+    m_normals[i] = length > 0.0f ? normal / length : Vector3::Zero();
+    AABB bounds = AABB::Create(Vector3::Min(Vector3::Min(v0, v1), v2), Vector3::Max(Vector3::Max(v0, v1), v2));
+    m_triangleBounds[i] = bounds;
+    m_bounds.encapsulate(bounds);
+  }
+  m_cacheValid = true;
+}
+
+} // namespace hydra
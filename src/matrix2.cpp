@@ -149,6 +149,7 @@ void Matrix2::scale(float s)
 /* Replace matrix with its inverse */
 bool Matrix2::invert()
 {
+  HYDRA_PROFILE_SCOPE("Matrix2::invert");
   float det = c[0] * c[3] - c[1] * c[2];
   if (det == 0) {
     return false;
@@ -74,13 +74,6 @@ Matrix4 Matrix4::Create(float* pMat)
   return r;
 }
 
-Matrix4 Matrix4::Create(const Vector3& new_axis_x, const Vector3& new_axis_y, const Vector3& new_axis_z, const Vector3& new_transform)
-{
-  Matrix4 r;
-  r.init(new_axis_x, new_axis_y, new_axis_z, new_transform);
-  return r;
-}
-
 float* Matrix4::getPointer()
 {
   return c;
@@ -102,35 +95,6 @@ bool Matrix4::operator==(const Matrix4& m) const
   return memcmp(c, m.c, sizeof(float) * 16) == 0;
 }
 
-// Overload compound multiply operator
-Matrix4& Matrix4::operator*=(const Matrix4& m)
-{
-  float temp[16];
-
-  int x, y;
-
-  for (x = 0; x < 4; x++) {
-    for (y = 0; y < 4; y++) {
-      temp[y + (x * 4)] = (c[x * 4] * m.c[y]) +
-        (c[(x * 4) + 1] * m.c[y + 4]) +
-        (c[(x * 4) + 2] * m.c[y + 8]) +
-        (c[(x * 4) + 3] * m.c[y + 12]);
-    }
-  }
-
-  memcpy(c, temp, sizeof(float) << 4);
-  return *this;
-}
-
-// Overload multiply operator
-Matrix4 Matrix4::operator*(const Matrix4& m) const
-{
-  Matrix4 ret = *this;
-  ret *= m;
-  return ret;
-}
-
-
 /* Generate a perspective view matrix using a field of view angle fov,
  * window aspect ratio, near and far clipping planes */
 void Matrix4::perspective(float fov, float aspect, float nearz, float farz)
@@ -275,6 +239,7 @@ void Matrix4::ortho(float left, float right, float top, float bottom, float near
 /* Replace matrix with its inverse */
 bool Matrix4::invert()
 {
+  HYDRA_PROFILE_SCOPE("Matrix4::invert");
   // Based on gluInvertMatrix implementation
 
   float inv[16], det;
@@ -339,18 +304,9 @@ void Matrix4::transpose()
   memcpy(c, trans, sizeof(float) * 16);
 }
 
-/* Dot Product, returning Vector3 */
-Vector3 Matrix4::Dot(const Matrix4& m, const Vector3& v)
-{
-  return Vector3::Create(
-      v.c[0] * m.c[0] + v.c[1] * m.c[4] + v.c[2] * m.c[8] + m.c[12],
-      v.c[0] * m.c[1] + v.c[1] * m.c[5] + v.c[2] * m.c[9] + m.c[13],
-      v.c[0] * m.c[2] + v.c[1] * m.c[6] + v.c[2] * m.c[10] + m.c[14]
-  );
-}
-
 Vector4 Matrix4::Dot4(const Matrix4& m, const Vector4& v)
 {
+  HYDRA_PROFILE_SCOPE("Matrix4::Dot4");
 #ifdef KRAKEN_USE_ARM_NEON
 
   Vector4 d;
@@ -386,6 +342,7 @@ Vector4 Matrix4::Dot4(const Matrix4& m, const Vector4& v)
 // Dot product without including translation; useful for transforming normals and tangents
 Vector3 Matrix4::DotNoTranslate(const Matrix4& m, const Vector3& v)
 {
+  HYDRA_PROFILE_SCOPE("Matrix4::DotNoTranslate");
   return Vector3::Create(
        v.x * m.c[0] + v.y * m.c[4] + v.z * m.c[8],
        v.x * m.c[1] + v.y * m.c[5] + v.z * m.c[9],
@@ -402,6 +359,7 @@ float Matrix4::DotW(const Matrix4& m, const Vector3& v)
 /* Dot Product followed by W-divide */
 Vector3 Matrix4::DotWDiv(const Matrix4& m, const Vector3& v)
 {
+  HYDRA_PROFILE_SCOPE("Matrix4::DotWDiv");
   Vector4 r = Dot4(m, Vector4::Create(v, 1.0f));
   return Vector3::Create(r) / r.w;
 }
@@ -449,17 +407,6 @@ Matrix4 Matrix4::Transpose(const Matrix4& m)
   return matTranspose;
 }
 
-Matrix4 Matrix4::Translation(const Vector3& v)
-{
-  Matrix4 m;
-  m.init();
-  m[12] = v.x;
-  m[13] = v.y;
-  m[14] = v.z;
-  //    m.translate(v);
-  return m;
-}
-
 Matrix4 Matrix4::Rotation(const Vector3& v)
 {
   Matrix4 m;
@@ -470,20 +417,5 @@ Matrix4 Matrix4::Rotation(const Vector3& v)
   return m;
 }
 
-Matrix4 Matrix4::Scaling(const Vector3& v)
-{
-  Matrix4 m;
-  m.init();
-  m.scale(v);
-  return m;
-}
-
-Matrix4 Matrix4::Identity()
-{
-  Matrix4 m;
-  m.init();
-  return m;
-}
-
 } // namespace hydra
 
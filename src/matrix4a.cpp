@@ -0,0 +1,186 @@
+//
+//  matrix4a.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace hydra {
+
+namespace {
+
+const size_t MATRIX4A_POINTS_PER_TASK = 4096; // Grain of batch transforms spread over a Scheduler
+
+} // anonymous namespace
+
+void Matrix4A::init()
+{
+  *this = Identity();
+}
+
+void Matrix4A::init(const Matrix4& m)
+{
+  memcpy(c, m.c, sizeof(float) * 16);
+}
+
+Matrix4A Matrix4A::Create(const Matrix4& m)
+{
+  Matrix4A r;
+  r.init(m);
+  return r;
+}
+
+Matrix4A::operator Matrix4() const
+{
+  Matrix4 r;
+  memcpy(r.c, c, sizeof(float) * 16);
+  return r;
+}
+
+// Overload comparison operator
+bool Matrix4A::operator==(const Matrix4A& m) const
+{
+  return memcmp(c, m.c, sizeof(float) * 16) == 0;
+}
+
+// Overload compound multiply operator
+Matrix4A& Matrix4A::operator*=(const Matrix4A& m)
+{
+  HYDRA_PROFILE_SCOPE("Matrix4A::operator*=");
+#ifdef __SSE2__
+  // Each column of the result is a linear combination of the columns of m
+  __m128 m0 = _mm_load_ps(m.c);
+  __m128 m1 = _mm_load_ps(m.c + 4);
+  __m128 m2 = _mm_load_ps(m.c + 8);
+  __m128 m3 = _mm_load_ps(m.c + 12);
+  __m128 temp[4];
+  for (int x = 0; x < 4; x++) {
+    __m128 r = _mm_mul_ps(m0, _mm_set1_ps(c[x * 4]));
+    r = _mm_add_ps(r, _mm_mul_ps(m1, _mm_set1_ps(c[x * 4 + 1])));
+    r = _mm_add_ps(r, _mm_mul_ps(m2, _mm_set1_ps(c[x * 4 + 2])));
+    r = _mm_add_ps(r, _mm_mul_ps(m3, _mm_set1_ps(c[x * 4 + 3])));
+    temp[x] = r;
+  }
+  for (int x = 0; x < 4; x++) {
+    _mm_store_ps(c + x * 4, temp[x]);
+  }
+#else
+  float temp[16];
+  for (int x = 0; x < 4; x++) {
+    for (int y = 0; y < 4; y++) {
+      temp[y + (x * 4)] = (c[x * 4] * m.c[y]) +
+        (c[(x * 4) + 1] * m.c[y + 4]) +
+        (c[(x * 4) + 2] * m.c[y + 8]) +
+        (c[(x * 4) + 3] * m.c[y + 12]);
+    }
+  }
+  memcpy(c, temp, sizeof(float) << 4);
+#endif
+  return *this;
+}
+
+// Overload multiply operator
+Matrix4A Matrix4A::operator*(const Matrix4A& m) const
+{
+  Matrix4A ret = *this;
+  ret *= m;
+  return ret;
+}
+
+Matrix4A Matrix4A::Invert(const Matrix4A& m)
+{
+  return Create(Matrix4::Invert(m));
+}
+
+Matrix4A Matrix4A::Transpose(const Matrix4A& m)
+{
+  return Create(Matrix4::Transpose(m));
+}
+
+/* Dot Product, returning Vector3A */
+Vector3A Matrix4A::Dot(const Matrix4A& m, const Vector3A& v)
+{
+  return Vector3A::Create(
+      v.c[0] * m.c[0] + v.c[1] * m.c[4] + v.c[2] * m.c[8] + m.c[12],
+      v.c[0] * m.c[1] + v.c[1] * m.c[5] + v.c[2] * m.c[9] + m.c[13],
+      v.c[0] * m.c[2] + v.c[1] * m.c[6] + v.c[2] * m.c[10] + m.c[14]
+  );
+}
+
+void Matrix4A::Dot(const Matrix4A& m, const Vector3A* v, Vector3A* out, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("Matrix4A::Dot(batch)");
+#ifdef __SSE2__
+  // Columns are loaded once; each point is a multiply-add of three columns
+  // onto the translation.  The w lane of the columns is cleared, so that the
+  // padding of the results stays zero.
+  __m128 xyz = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+  __m128 m0 = _mm_and_ps(_mm_load_ps(m.c), xyz);
+  __m128 m1 = _mm_and_ps(_mm_load_ps(m.c + 4), xyz);
+  __m128 m2 = _mm_and_ps(_mm_load_ps(m.c + 8), xyz);
+  __m128 m3 = _mm_and_ps(_mm_load_ps(m.c + 12), xyz);
+  for (size_t i = 0; i < count; i++) {
+    __m128 p = _mm_load_ps(v[i].c);
+    __m128 r = _mm_add_ps(m3, _mm_mul_ps(m0, _mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 0, 0, 0))));
+    r = _mm_add_ps(r, _mm_mul_ps(m1, _mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1))));
+    r = _mm_add_ps(r, _mm_mul_ps(m2, _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2))));
+    _mm_store_ps(out[i].c, r);
+  }
+#else
+  for (size_t i = 0; i < count; i++) {
+    out[i] = Dot(m, v[i]);
+  }
+#endif
+}
+
+void Matrix4A::Dot(const Matrix4A& m, const Vector3A* v, Vector3A* out, size_t count, Scheduler& scheduler)
+{
+  HYDRA_PROFILE_SCOPE("Matrix4A::Dot(batch, scheduler)");
+  scheduler.parallelFor(0, count, MATRIX4A_POINTS_PER_TASK, [&m, v, out](size_t begin, size_t end) {
+    Dot(m, v + begin, out + begin, end - begin);
+  });
+}
+
+// Dot product without including translation; useful for transforming normals and tangents
+Vector3A Matrix4A::DotNoTranslate(const Matrix4A& m, const Vector3A& v)
+{
+  return Vector3A::Create(
+       v.x * m.c[0] + v.y * m.c[4] + v.z * m.c[8],
+       v.x * m.c[1] + v.y * m.c[5] + v.z * m.c[9],
+       v.x * m.c[2] + v.y * m.c[6] + v.z * m.c[10]
+  );
+}
+
+} // namespace hydra
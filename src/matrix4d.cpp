@@ -0,0 +1,341 @@
+//
+//  matrix4d.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+
+#include <string.h>
+
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
+namespace hydra {
+
+namespace {
+
+const size_t MATRIX4D_POINTS_PER_TASK = 4096; // Grain of batch transforms spread over a Scheduler
+
+} // anonymous namespace
+
+void Matrix4d::init()
+{
+  // Default constructor - Initialize with an identity matrix
+  *this = Matrix4d::Identity();
+}
+
+void Matrix4d::init(double* pMat)
+{
+  memcpy(c, pMat, sizeof(double) * 16);
+}
+
+void Matrix4d::init(const Vector3d& new_axis_x, const Vector3d& new_axis_y, const Vector3d& new_axis_z, const Vector3d& new_transform)
+{
+  *this = Matrix4d::Create(new_axis_x, new_axis_y, new_axis_z, new_transform);
+}
+
+void Matrix4d::init(const Matrix4d& m)
+{
+  memcpy(c, m.c, sizeof(double) * 16);
+}
+
+void Matrix4d::init(const Matrix4& m)
+{
+  for (int i = 0; i < 16; i++) {
+    c[i] = m.c[i];
+  }
+}
+
+Matrix4d Matrix4d::Create(double* pMat)
+{
+  Matrix4d r;
+  r.init(pMat);
+  return r;
+}
+
+Matrix4d Matrix4d::Create(const Matrix4& m)
+{
+  Matrix4d r;
+  r.init(m);
+  return r;
+}
+
+Matrix4 Matrix4d::asMatrix4() const
+{
+  Matrix4 r;
+  for (int i = 0; i < 16; i++) {
+    r.c[i] = (float)c[i];
+  }
+  return r;
+}
+
+Matrix4 Matrix4d::asMatrix4(const Vector3d& origin) const
+{
+  // The subtraction happens in double precision, so an object near origin
+  // keeps its precision no matter how far origin is from the world center.
+  // Assumes an affine transform, with a bottom row of (0, 0, 0, 1).
+  Matrix4 r = asMatrix4();
+  r.c[12] = (float)(c[12] - origin.x);
+  r.c[13] = (float)(c[13] - origin.y);
+  r.c[14] = (float)(c[14] - origin.z);
+  return r;
+}
+
+double* Matrix4d::getPointer()
+{
+  return c;
+}
+
+double& Matrix4d::operator[](unsigned i)
+{
+  return c[i];
+}
+
+double Matrix4d::operator[](unsigned i) const
+{
+  return c[i];
+}
+
+// Overload comparison operator
+bool Matrix4d::operator==(const Matrix4d& m) const
+{
+  return memcmp(c, m.c, sizeof(double) * 16) == 0;
+}
+
+// Overload compound multiply operator
+Matrix4d& Matrix4d::operator*=(const Matrix4d& m)
+{
+  HYDRA_PROFILE_SCOPE("Matrix4d::operator*=");
+  double temp[16];
+
+#ifdef __AVX__
+  // Each column of the result is a linear combination of the columns of m,
+  // computed four rows at a time
+  __m256d m0 = _mm256_loadu_pd(m.c);
+  __m256d m1 = _mm256_loadu_pd(m.c + 4);
+  __m256d m2 = _mm256_loadu_pd(m.c + 8);
+  __m256d m3 = _mm256_loadu_pd(m.c + 12);
+  for (int x = 0; x < 4; x++) {
+    __m256d r = _mm256_mul_pd(m0, _mm256_broadcast_sd(c + x * 4));
+    r = _mm256_add_pd(r, _mm256_mul_pd(m1, _mm256_broadcast_sd(c + x * 4 + 1)));
+    r = _mm256_add_pd(r, _mm256_mul_pd(m2, _mm256_broadcast_sd(c + x * 4 + 2)));
+    r = _mm256_add_pd(r, _mm256_mul_pd(m3, _mm256_broadcast_sd(c + x * 4 + 3)));
+    _mm256_storeu_pd(temp + x * 4, r);
+  }
+#else
+  for (int x = 0; x < 4; x++) {
+    for (int y = 0; y < 4; y++) {
+      temp[y + (x * 4)] = (c[x * 4] * m.c[y]) +
+        (c[(x * 4) + 1] * m.c[y + 4]) +
+        (c[(x * 4) + 2] * m.c[y + 8]) +
+        (c[(x * 4) + 3] * m.c[y + 12]);
+    }
+  }
+#endif
+
+  memcpy(c, temp, sizeof(double) << 4);
+  return *this;
+}
+
+// Overload multiply operator
+Matrix4d Matrix4d::operator*(const Matrix4d& m) const
+{
+  Matrix4d ret = *this;
+  ret *= m;
+  return ret;
+}
+
+void Matrix4d::translate(const Vector3d& v)
+{
+  *this *= Matrix4d::Translation(v);
+}
+
+void Matrix4d::scale(const Vector3d& v)
+{
+  *this *= Matrix4d::Scaling(v);
+}
+
+void Matrix4d::rotate(const Quaternion& q)
+{
+  rotate(Quaterniond::Create(q));
+}
+
+void Matrix4d::rotate(const Quaterniond& q)
+{
+  *this *= q.rotationMatrix();
+}
+
+/* Replace matrix with its inverse */
+bool Matrix4d::invert()
+{
+  HYDRA_PROFILE_SCOPE("Matrix4d::invert");
+  // Based on gluInvertMatrix implementation
+
+  double inv[16], det;
+  int i;
+
+  inv[0] = c[5] * c[10] * c[15] - c[5] * c[11] * c[14] - c[9] * c[6] * c[15]
+    + c[9] * c[7] * c[14] + c[13] * c[6] * c[11] - c[13] * c[7] * c[10];
+  inv[4] = -c[4] * c[10] * c[15] + c[4] * c[11] * c[14] + c[8] * c[6] * c[15]
+    - c[8] * c[7] * c[14] - c[12] * c[6] * c[11] + c[12] * c[7] * c[10];
+  inv[8] = c[4] * c[9] * c[15] - c[4] * c[11] * c[13] - c[8] * c[5] * c[15]
+    + c[8] * c[7] * c[13] + c[12] * c[5] * c[11] - c[12] * c[7] * c[9];
+  inv[12] = -c[4] * c[9] * c[14] + c[4] * c[10] * c[13] + c[8] * c[5] * c[14]
+    - c[8] * c[6] * c[13] - c[12] * c[5] * c[10] + c[12] * c[6] * c[9];
+  inv[1] = -c[1] * c[10] * c[15] + c[1] * c[11] * c[14] + c[9] * c[2] * c[15]
+    - c[9] * c[3] * c[14] - c[13] * c[2] * c[11] + c[13] * c[3] * c[10];
+  inv[5] = c[0] * c[10] * c[15] - c[0] * c[11] * c[14] - c[8] * c[2] * c[15]
+    + c[8] * c[3] * c[14] + c[12] * c[2] * c[11] - c[12] * c[3] * c[10];
+  inv[9] = -c[0] * c[9] * c[15] + c[0] * c[11] * c[13] + c[8] * c[1] * c[15]
+    - c[8] * c[3] * c[13] - c[12] * c[1] * c[11] + c[12] * c[3] * c[9];
+  inv[13] = c[0] * c[9] * c[14] - c[0] * c[10] * c[13] - c[8] * c[1] * c[14]
+    + c[8] * c[2] * c[13] + c[12] * c[1] * c[10] - c[12] * c[2] * c[9];
+  inv[2] = c[1] * c[6] * c[15] - c[1] * c[7] * c[14] - c[5] * c[2] * c[15]
+    + c[5] * c[3] * c[14] + c[13] * c[2] * c[7] - c[13] * c[3] * c[6];
+  inv[6] = -c[0] * c[6] * c[15] + c[0] * c[7] * c[14] + c[4] * c[2] * c[15]
+    - c[4] * c[3] * c[14] - c[12] * c[2] * c[7] + c[12] * c[3] * c[6];
+  inv[10] = c[0] * c[5] * c[15] - c[0] * c[7] * c[13] - c[4] * c[1] * c[15]
+    + c[4] * c[3] * c[13] + c[12] * c[1] * c[7] - c[12] * c[3] * c[5];
+  inv[14] = -c[0] * c[5] * c[14] + c[0] * c[6] * c[13] + c[4] * c[1] * c[14]
+    - c[4] * c[2] * c[13] - c[12] * c[1] * c[6] + c[12] * c[2] * c[5];
+  inv[3] = -c[1] * c[6] * c[11] + c[1] * c[7] * c[10] + c[5] * c[2] * c[11]
+    - c[5] * c[3] * c[10] - c[9] * c[2] * c[7] + c[9] * c[3] * c[6];
+  inv[7] = c[0] * c[6] * c[11] - c[0] * c[7] * c[10] - c[4] * c[2] * c[11]
+    + c[4] * c[3] * c[10] + c[8] * c[2] * c[7] - c[8] * c[3] * c[6];
+  inv[11] = -c[0] * c[5] * c[11] + c[0] * c[7] * c[9] + c[4] * c[1] * c[11]
+    - c[4] * c[3] * c[9] - c[8] * c[1] * c[7] + c[8] * c[3] * c[5];
+  inv[15] = c[0] * c[5] * c[10] - c[0] * c[6] * c[9] - c[4] * c[1] * c[10]
+    + c[4] * c[2] * c[9] + c[8] * c[1] * c[6] - c[8] * c[2] * c[5];
+
+  det = c[0] * inv[0] + c[1] * inv[4] + c[2] * inv[8] + c[3] * inv[12];
+
+  if (det == 0) {
+    return false;
+  }
+
+  det = 1.0 / det;
+
+  for (i = 0; i < 16; i++) {
+    c[i] = inv[i] * det;
+  }
+
+  return true;
+}
+
+void Matrix4d::transpose()
+{
+  double trans[16];
+  for (int x = 0; x < 4; x++) {
+    for (int y = 0; y < 4; y++) {
+      trans[x + y * 4] = c[y + x * 4];
+    }
+  }
+  memcpy(c, trans, sizeof(double) * 16);
+}
+
+/* Dot Product, returning Vector3d */
+Vector3d Matrix4d::Dot(const Matrix4d& m, const Vector3d& v)
+{
+  return Vector3d::Create(
+      v.c[0] * m.c[0] + v.c[1] * m.c[4] + v.c[2] * m.c[8] + m.c[12],
+      v.c[0] * m.c[1] + v.c[1] * m.c[5] + v.c[2] * m.c[9] + m.c[13],
+      v.c[0] * m.c[2] + v.c[1] * m.c[6] + v.c[2] * m.c[10] + m.c[14]
+  );
+}
+
+void Matrix4d::Dot(const Matrix4d& m, const Vector3d* v, Vector3d* out, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("Matrix4d::Dot(batch)");
+#ifdef __AVX__
+  // Columns are loaded once; each point is a multiply-add of three columns
+  // onto the translation, with the unused w lane masked off on store
+  __m256d m0 = _mm256_loadu_pd(m.c);
+  __m256d m1 = _mm256_loadu_pd(m.c + 4);
+  __m256d m2 = _mm256_loadu_pd(m.c + 8);
+  __m256d m3 = _mm256_loadu_pd(m.c + 12);
+  __m256i xyz = _mm256_set_epi64x(0, -1, -1, -1);
+  for (size_t i = 0; i < count; i++) {
+    __m256d r = _mm256_add_pd(m3, _mm256_mul_pd(m0, _mm256_broadcast_sd(&v[i].x)));
+    r = _mm256_add_pd(r, _mm256_mul_pd(m1, _mm256_broadcast_sd(&v[i].y)));
+    r = _mm256_add_pd(r, _mm256_mul_pd(m2, _mm256_broadcast_sd(&v[i].z)));
+    _mm256_maskstore_pd(out[i].c, xyz, r);
+  }
+#else
+  for (size_t i = 0; i < count; i++) {
+    out[i] = Dot(m, v[i]);
+  }
+#endif
+}
+
+void Matrix4d::Dot(const Matrix4d& m, const Vector3d* v, Vector3d* out, size_t count, Scheduler& scheduler)
+{
+  HYDRA_PROFILE_SCOPE("Matrix4d::Dot(batch, scheduler)");
+  scheduler.parallelFor(0, count, MATRIX4D_POINTS_PER_TASK, [&m, v, out](size_t begin, size_t end) {
+    Dot(m, v + begin, out + begin, end - begin);
+  });
+}
+
+// Dot product without including translation; useful for transforming normals and tangents
+Vector3d Matrix4d::DotNoTranslate(const Matrix4d& m, const Vector3d& v)
+{
+  return Vector3d::Create(
+       v.x * m.c[0] + v.y * m.c[4] + v.z * m.c[8],
+       v.x * m.c[1] + v.y * m.c[5] + v.z * m.c[9],
+       v.x * m.c[2] + v.y * m.c[6] + v.z * m.c[10]
+  );
+}
+
+/* Dot Product, returning w component as if it were a Vector4 */
+double Matrix4d::DotW(const Matrix4d& m, const Vector3d& v)
+{
+  return v.x * m.c[0 * 4 + 3] + v.y * m.c[1 * 4 + 3] + v.z * m.c[2 * 4 + 3] + m.c[3 * 4 + 3];
+}
+
+/* Dot Product followed by W-divide */
+Vector3d Matrix4d::DotWDiv(const Matrix4d& m, const Vector3d& v)
+{
+  return Dot(m, v) / DotW(m, v);
+}
+
+Matrix4d Matrix4d::Invert(const Matrix4d& m)
+{
+  Matrix4d matInvert = m;
+  matInvert.invert();
+  return matInvert;
+}
+
+Matrix4d Matrix4d::Transpose(const Matrix4d& m)
+{
+  Matrix4d matTranspose = m;
+  matTranspose.transpose();
+  return matTranspose;
+}
+
+} // namespace hydra
@@ -0,0 +1,93 @@
+//
+//  matrixinversecache.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+
+namespace hydra {
+
+MatrixInverseCache::MatrixInverseCache(size_t capacity)
+  : m_cache(capacity)
+{
+  m_hits = 0;
+  m_misses = 0;
+}
+
+MatrixInverseCache::~MatrixInverseCache()
+{
+
+}
+
+bool MatrixInverseCache::invert(const Matrix4& m, Matrix4& inverse)
+{
+  HYDRA_PROFILE_SCOPE("MatrixInverseCache::invert");
+  const CachedInverse* cached = m_cache.find(m);
+  if (cached) {
+    m_hits++;
+  } else {
+    m_misses++;
+    CachedInverse entry;
+    entry.inverse = m;
+    entry.invertible = entry.inverse.invert();
+    m_cache.insert(m, entry);
+    cached = m_cache.find(m);
+  }
+  if (!cached->invertible) {
+    return false;
+  }
+  inverse = cached->inverse;
+  return true;
+}
+
+Matrix4 MatrixInverseCache::invert(const Matrix4& m)
+{
+  Matrix4 inverse = m;
+  invert(m, inverse);
+  return inverse;
+}
+
+void MatrixInverseCache::clear()
+{
+  m_cache.clear();
+  m_hits = 0;
+  m_misses = 0;
+}
+
+size_t MatrixInverseCache::hits() const
+{
+  return m_hits;
+}
+
+size_t MatrixInverseCache::misses() const
+{
+  return m_misses;
+}
+
+} // namespace hydra
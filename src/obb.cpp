@@ -0,0 +1,533 @@
+//
+//  obb.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+#include "krhelpers.h"
+
+namespace hydra {
+
+namespace {
+
+OBB _fitToAxes(const Vector3* points, size_t count, const Vector3& axisX, const Vector3& axisY, const Vector3& axisZ)
+{
+  Vector3 axes[3] = { axisX, axisY, axisZ };
+  Vector3 projMin = Vector3::Create(std::numeric_limits<float>::max());
+  Vector3 projMax = Vector3::Create(-std::numeric_limits<float>::max());
+  for (size_t i = 0; i < count; i++) {
+    for (int a = 0; a < 3; a++) {
+      float d = Vector3::Dot(points[i], axes[a]);
+      projMin[a] = KRMIN(projMin[a], d);
+      projMax[a] = KRMAX(projMax[a], d);
+    }
+  }
+  Vector3 mid = (projMin + projMax) * 0.5f;
+  return OBB::Create(axisX * mid.x + axisY * mid.y + axisZ * mid.z, (projMax - projMin) * 0.5f, axisX, axisY, axisZ);
+}
+
+float _halfSurfaceArea(const Vector3* points, size_t count, const Vector3& axisX, const Vector3& axisY, const Vector3& axisZ)
+{
+  Vector3 e = _fitToAxes(points, count, axisX, axisY, axisZ).halfExtents;
+  return e.x * e.y + e.y * e.z + e.z * e.x;
+}
+
+void _jacobiEigenvectors(float a[3][3], float v[3][3])
+{
+  // Cyclic Jacobi eigenvalue iteration for a symmetric 3x3 matrix.  On return,
+  // the columns of v hold the eigenvectors.
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      v[i][j] = i == j ? 1.0f : 0.0f;
+    }
+  }
+  static const int pairs[3][2] = { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+  for (int sweep = 0; sweep < 32; sweep++) {
+    float off = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+    if (off < 0.0000000001f) {
+      break;
+    }
+    for (int pi = 0; pi < 3; pi++) {
+      int p = pairs[pi][0];
+      int q = pairs[pi][1];
+      if (a[p][q] == 0.0f) {
+        continue;
+      }
+      float theta = (a[q][q] - a[p][p]) / (2.0f * a[p][q]);
+      float t = (theta >= 0.0f ? 1.0f : -1.0f) / (fabs(theta) + sqrtf(theta * theta + 1.0f));
+      float c = 1.0f / sqrtf(t * t + 1.0f);
+      float s = t * c;
+      for (int k = 0; k < 3; k++) {
+        float akp = a[k][p];
+        float akq = a[k][q];
+        a[k][p] = c * akp - s * akq;
+        a[k][q] = s * akp + c * akq;
+      }
+      for (int k = 0; k < 3; k++) {
+        float apk = a[p][k];
+        float aqk = a[q][k];
+        a[p][k] = c * apk - s * aqk;
+        a[q][k] = s * apk + c * aqk;
+      }
+      for (int k = 0; k < 3; k++) {
+        float vkp = v[k][p];
+        float vkq = v[k][q];
+        v[k][p] = c * vkp - s * vkq;
+        v[k][q] = s * vkp + c * vkq;
+      }
+    }
+  }
+}
+
+void _perpendicularAxes(const Vector3& axis, Vector3& axisY, Vector3& axisZ)
+{
+  Vector3 other = fabs(axis.x) < 0.6f ? Vector3::Right() : Vector3::Up();
+  axisY = Vector3::Normalize(Vector3::Cross(axis, other));
+  axisZ = Vector3::Cross(axis, axisY);
+}
+
+} // anonymous namespace
+
+void OBB::init()
+{
+  center = Vector3::Zero();
+  halfExtents = Vector3::Zero();
+  axis[0] = Vector3::Right();
+  axis[1] = Vector3::Up();
+  axis[2] = Vector3::Forward();
+}
+
+OBB OBB::Create()
+{
+  OBB r;
+  r.init();
+  return r;
+}
+
+void OBB::init(const Vector3& boxCenter, const Vector3& boxHalfExtents, const Vector3& axisX, const Vector3& axisY, const Vector3& axisZ)
+{
+  center = boxCenter;
+  halfExtents = boxHalfExtents;
+  axis[0] = axisX;
+  axis[1] = axisY;
+  axis[2] = axisZ;
+}
+
+OBB OBB::Create(const Vector3& boxCenter, const Vector3& boxHalfExtents, const Vector3& axisX, const Vector3& axisY, const Vector3& axisZ)
+{
+  OBB r;
+  r.init(boxCenter, boxHalfExtents, axisX, axisY, axisZ);
+  return r;
+}
+
+void OBB::init(const Vector3& boxCenter, const Vector3& boxHalfExtents, const Quaternion& rotation)
+{
+  Matrix4 m = rotation.rotationMatrix();
+  init(boxCenter, boxHalfExtents, Vector3::Create(m.axis_x), Vector3::Create(m.axis_y), Vector3::Create(m.axis_z));
+}
+
+OBB OBB::Create(const Vector3& boxCenter, const Vector3& boxHalfExtents, const Quaternion& rotation)
+{
+  OBB r;
+  r.init(boxCenter, boxHalfExtents, rotation);
+  return r;
+}
+
+void OBB::init(const AABB& box)
+{
+  init(box.center(), box.size() * 0.5f, Vector3::Right(), Vector3::Up(), Vector3::Forward());
+}
+
+OBB OBB::Create(const AABB& box)
+{
+  OBB r;
+  r.init(box);
+  return r;
+}
+
+void OBB::init(const AABB& box, const Matrix4& modelMatrix)
+{
+  // The matrix is assumed to be affine and free of shear, so that its columns
+  // are orthogonal; their lengths give the scale along each axis.
+  static const Vector3 unitAxes[3] = { Vector3::Create(1.0f, 0.0f, 0.0f), Vector3::Create(0.0f, 1.0f, 0.0f), Vector3::Create(0.0f, 0.0f, 1.0f) };
+  center = Matrix4::Dot(modelMatrix, box.center());
+  Vector3 size = box.size() * 0.5f;
+  for (int i = 0; i < 3; i++) {
+    Vector3 column = Vector3::Create(modelMatrix.c[i * 4], modelMatrix.c[i * 4 + 1], modelMatrix.c[i * 4 + 2]);
+    float scale = column.magnitude();
+    axis[i] = scale > 0.0f ? column / scale : unitAxes[i];
+    halfExtents[i] = size[i] * scale;
+  }
+}
+
+OBB OBB::Create(const AABB& box, const Matrix4& modelMatrix)
+{
+  OBB r;
+  r.init(box, modelMatrix);
+  return r;
+}
+
+Quaternion OBB::rotation() const
+{
+  return Quaternion::FromRotationMatrix(Matrix4::Create(axis[0], axis[1], axis[2], Vector3::Zero()));
+}
+
+Matrix4 OBB::modelMatrix() const
+{
+  return Matrix4::Create(axis[0] * halfExtents.x, axis[1] * halfExtents.y, axis[2] * halfExtents.z, center);
+}
+
+AABB OBB::bounds() const
+{
+  Vector3 extent = Vector3::Create(
+    fabs(axis[0].x) * halfExtents.x + fabs(axis[1].x) * halfExtents.y + fabs(axis[2].x) * halfExtents.z,
+    fabs(axis[0].y) * halfExtents.x + fabs(axis[1].y) * halfExtents.y + fabs(axis[2].y) * halfExtents.z,
+    fabs(axis[0].z) * halfExtents.x + fabs(axis[1].z) * halfExtents.y + fabs(axis[2].z) * halfExtents.z);
+  return AABB::Create(center - extent, center + extent);
+}
+
+float OBB::volume() const
+{
+  return 8.0f * halfExtents.x * halfExtents.y * halfExtents.z;
+}
+
+float OBB::surfaceArea() const
+{
+  return 8.0f * (halfExtents.x * halfExtents.y + halfExtents.y * halfExtents.z + halfExtents.z * halfExtents.x);
+}
+
+void OBB::corners(Vector3* out) const
+{
+  for (int iCorner = 0; iCorner < 8; iCorner++) {
+    out[iCorner] = center
+      + axis[0] * ((iCorner & 1) == 0 ? -halfExtents.x : halfExtents.x)
+      + axis[1] * ((iCorner & 2) == 0 ? -halfExtents.y : halfExtents.y)
+      + axis[2] * ((iCorner & 4) == 0 ? -halfExtents.z : halfExtents.z);
+  }
+}
+
+bool OBB::contains(const Vector3& p) const
+{
+  Vector3 d = p - center;
+  return fabs(Vector3::Dot(d, axis[0])) <= halfExtents.x
+    && fabs(Vector3::Dot(d, axis[1])) <= halfExtents.y
+    && fabs(Vector3::Dot(d, axis[2])) <= halfExtents.z;
+}
+
+Vector3 OBB::nearestPoint(const Vector3& p) const
+{
+  Vector3 d = p - center;
+  Vector3 r = center;
+  for (int i = 0; i < 3; i++) {
+    float dist = Vector3::Dot(d, axis[i]);
+    r += axis[i] * KRCLAMP(dist, -halfExtents[i], halfExtents[i]);
+  }
+  return r;
+}
+
+bool OBB::intersects(const OBB& b) const
+{
+  // From: Real-Time Collision Detection, Christer Ericson, 4.4.1
+  // Tests the 15 potential separating axes: the 3 face normals of each box
+  // and the 9 cross products of their edges.
+  const float EPSILON = 0.000001f; // Guards against a zero cross product between parallel edges
+
+  float R[3][3];
+  float AbsR[3][3];
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      R[i][j] = Vector3::Dot(axis[i], b.axis[j]);
+      AbsR[i][j] = fabs(R[i][j]) + EPSILON;
+    }
+  }
+
+  // Translation, in this box's frame
+  Vector3 tw = b.center - center;
+  float t[3] = { Vector3::Dot(tw, axis[0]), Vector3::Dot(tw, axis[1]), Vector3::Dot(tw, axis[2]) };
+
+  for (int i = 0; i < 3; i++) {
+    float ra = halfExtents[i];
+    float rb = b.halfExtents[0] * AbsR[i][0] + b.halfExtents[1] * AbsR[i][1] + b.halfExtents[2] * AbsR[i][2];
+    if (fabs(t[i]) > ra + rb) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 3; i++) {
+    float ra = halfExtents[0] * AbsR[0][i] + halfExtents[1] * AbsR[1][i] + halfExtents[2] * AbsR[2][i];
+    float rb = b.halfExtents[i];
+    if (fabs(t[0] * R[0][i] + t[1] * R[1][i] + t[2] * R[2][i]) > ra + rb) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 3; i++) {
+    int i1 = (i + 1) % 3;
+    int i2 = (i + 2) % 3;
+    for (int j = 0; j < 3; j++) {
+      int j1 = (j + 1) % 3;
+      int j2 = (j + 2) % 3;
+      float ra = halfExtents[i1] * AbsR[i2][j] + halfExtents[i2] * AbsR[i1][j];
+      float rb = b.halfExtents[j1] * AbsR[i][j2] + b.halfExtents[j2] * AbsR[i][j1];
+      if (fabs(t[i2] * R[i1][j] - t[i1] * R[i2][j]) > ra + rb) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+bool OBB::intersects(const AABB& b) const
+{
+  return intersects(OBB::Create(b));
+}
+
+bool OBB::intersectsRay(const Vector3& start, const Vector3& dir) const
+{
+  float distance;
+  return intersectsRay(start, dir, distance);
+}
+
+bool OBB::intersectsRay(const Vector3& start, const Vector3& dir, float& distance) const
+{
+  // Slab test in the box's local frame
+  Vector3 d = start - center;
+  float tmin = 0.0f;
+  float tmax = std::numeric_limits<float>::max();
+  for (int i = 0; i < 3; i++) {
+    float o = Vector3::Dot(d, axis[i]);
+    float v = Vector3::Dot(dir, axis[i]);
+    if (v == 0.0f) {
+      if (fabs(o) > halfExtents[i]) {
+        return false; // Parallel to the slab and outside of it
+      }
+      continue;
+    }
+    float inv_v = 1.0f / v;
+    float t1 = (-halfExtents[i] - o) * inv_v;
+    float t2 = (halfExtents[i] - o) * inv_v;
+    tmin = KRMAX(tmin, KRMIN(t1, t2));
+    tmax = KRMIN(tmax, KRMAX(t1, t2));
+    if (tmin > tmax) {
+      return false;
+    }
+  }
+  distance = tmin;
+  return true;
+}
+
+bool OBB::operator ==(const OBB& b) const
+{
+  return center == b.center && halfExtents == b.halfExtents && axis[0] == b.axis[0] && axis[1] == b.axis[1] && axis[2] == b.axis[2];
+}
+
+bool OBB::operator !=(const OBB& b) const
+{
+  return !(*this == b);
+}
+
+OBB OBB::FitPCA(const Vector3* points, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("OBB::FitPCA");
+  if (count == 0) {
+    return OBB::Create();
+  }
+
+  Vector3 mean = Vector3::Zero();
+  for (size_t i = 0; i < count; i++) {
+    mean += points[i];
+  }
+  mean /= (float)count;
+
+  float covariance[3][3] = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } };
+  for (size_t i = 0; i < count; i++) {
+    Vector3 d = points[i] - mean;
+    for (int r = 0; r < 3; r++) {
+      for (int c = r; c < 3; c++) {
+        covariance[r][c] += d[r] * d[c];
+      }
+    }
+  }
+  covariance[1][0] = covariance[0][1];
+  covariance[2][0] = covariance[0][2];
+  covariance[2][1] = covariance[1][2];
+
+  float v[3][3];
+  _jacobiEigenvectors(covariance, v);
+  Vector3 axisX = Vector3::Normalize(Vector3::Create(v[0][0], v[1][0], v[2][0]));
+  Vector3 axisY = Vector3::Create(v[0][1], v[1][1], v[2][1]);
+  axisY = Vector3::Normalize(axisY - axisX * Vector3::Dot(axisY, axisX));
+  return _fitToAxes(points, count, axisX, axisY, Vector3::Cross(axisX, axisY));
+}
+
+OBB OBB::FitDiTO(const Vector3* points, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("OBB::FitDiTO");
+  // From: Fast Computation of Tight-Fitting Oriented Bounding Boxes,
+  // Thomas Larsson and Linus Kallberg, Game Engine Gems 2
+  const float SMALL_NUM = 0.000001f;
+  if (count == 0) {
+    return OBB::Create();
+  }
+
+  // Extremal points along 7 fixed directions
+  static const Vector3 normals[7] = {
+    Vector3::Create(1.0f, 0.0f, 0.0f), Vector3::Create(0.0f, 1.0f, 0.0f), Vector3::Create(0.0f, 0.0f, 1.0f),
+    Vector3::Create(1.0f, 1.0f, 1.0f), Vector3::Create(1.0f, 1.0f, -1.0f), Vector3::Create(1.0f, -1.0f, 1.0f), Vector3::Create(1.0f, -1.0f, -1.0f)
+  };
+  Vector3 extremal[14];
+  float projMin[7];
+  float projMax[7];
+  for (int n = 0; n < 7; n++) {
+    projMin[n] = projMax[n] = Vector3::Dot(points[0], normals[n]);
+    extremal[n * 2] = extremal[n * 2 + 1] = points[0];
+  }
+  for (size_t i = 1; i < count; i++) {
+    for (int n = 0; n < 7; n++) {
+      float d = Vector3::Dot(points[i], normals[n]);
+      if (d < projMin[n]) {
+        projMin[n] = d;
+        extremal[n * 2] = points[i];
+      }
+      if (d > projMax[n]) {
+        projMax[n] = d;
+        extremal[n * 2 + 1] = points[i];
+      }
+    }
+  }
+
+  // The base triangle: the most distant pair of extremal points, and the
+  // extremal point farthest from the line through them
+  int pair = 0;
+  float pairDistance = -1.0f;
+  for (int n = 0; n < 7; n++) {
+    float d = (extremal[n * 2 + 1] - extremal[n * 2]).sqrMagnitude();
+    if (d > pairDistance) {
+      pairDistance = d;
+      pair = n;
+    }
+  }
+  Vector3 p0 = extremal[pair * 2];
+  Vector3 p1 = extremal[pair * 2 + 1];
+  if (pairDistance <= SMALL_NUM) {
+    return OBB::Create(p0, Vector3::Zero(), Vector3::Right(), Vector3::Up(), Vector3::Forward());
+  }
+  Vector3 e0 = Vector3::Normalize(p1 - p0);
+
+  Vector3 p2 = p0;
+  float lineDistance = -1.0f;
+  for (int i = 0; i < 14; i++) {
+    Vector3 d = extremal[i] - p0;
+    float dist = (d - e0 * Vector3::Dot(d, e0)).sqrMagnitude();
+    if (dist > lineDistance) {
+      lineDistance = dist;
+      p2 = extremal[i];
+    }
+  }
+  if (lineDistance <= SMALL_NUM) {
+    // Collinear points
+    Vector3 axisY, axisZ;
+    _perpendicularAxes(e0, axisY, axisZ);
+    return _fitToAxes(points, count, e0, axisY, axisZ);
+  }
+
+  // Candidate orientations are formed from each edge and the normal of the
+  // base triangle and of the two tetrahedra built on it from the extremal
+  // points farthest above and below its plane.  They are scored on the
+  // extremal points only.
+  Vector3 bestAxes[3] = { Vector3::Right(), Vector3::Up(), Vector3::Forward() };
+  float bestArea = _halfSurfaceArea(extremal, 14, bestAxes[0], bestAxes[1], bestAxes[2]);
+
+  Vector3 triangles[7][3];
+  int triangleCount = 0;
+  triangles[triangleCount][0] = p0;
+  triangles[triangleCount][1] = p1;
+  triangles[triangleCount][2] = p2;
+  triangleCount++;
+
+  Vector3 n = Vector3::Normalize(Vector3::Cross(p1 - p0, p2 - p0));
+  float baseDistance = Vector3::Dot(n, p0);
+  Vector3 above = p0;
+  Vector3 below = p0;
+  float aboveDistance = 0.0f;
+  float belowDistance = 0.0f;
+  for (int i = 0; i < 14; i++) {
+    float d = Vector3::Dot(n, extremal[i]) - baseDistance;
+    if (d > aboveDistance) {
+      aboveDistance = d;
+      above = extremal[i];
+    }
+    if (d < belowDistance) {
+      belowDistance = d;
+      below = extremal[i];
+    }
+  }
+  for (int apexIndex = 0; apexIndex < 2; apexIndex++) {
+    float apexDistance = apexIndex == 0 ? aboveDistance : -belowDistance;
+    if (apexDistance <= SMALL_NUM) {
+      continue;
+    }
+    Vector3 apex = apexIndex == 0 ? above : below;
+    Vector3 base[3] = { p0, p1, p2 };
+    for (int e = 0; e < 3; e++) {
+      triangles[triangleCount][0] = base[e];
+      triangles[triangleCount][1] = base[(e + 1) % 3];
+      triangles[triangleCount][2] = apex;
+      triangleCount++;
+    }
+  }
+
+  for (int t = 0; t < triangleCount; t++) {
+    Vector3 normal = Vector3::Cross(triangles[t][1] - triangles[t][0], triangles[t][2] - triangles[t][0]);
+    if (normal.sqrMagnitude() <= SMALL_NUM) {
+      continue;
+    }
+    normal.normalize();
+    for (int e = 0; e < 3; e++) {
+      Vector3 edge = triangles[t][(e + 1) % 3] - triangles[t][e];
+      if (edge.sqrMagnitude() <= SMALL_NUM) {
+        continue;
+      }
+      edge.normalize();
+      Vector3 side = Vector3::Cross(normal, edge);
+      float area = _halfSurfaceArea(extremal, 14, edge, side, normal);
+      if (area < bestArea) {
+        bestArea = area;
+        bestAxes[0] = edge;
+        bestAxes[1] = side;
+        bestAxes[2] = normal;
+      }
+    }
+  }
+
+  return _fitToAxes(points, count, bestAxes[0], bestAxes[1], bestAxes[2]);
+}
+
+} // namespace hydra
@@ -0,0 +1,109 @@
+//
+//  octahedralnormal.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+
+namespace hydra {
+
+namespace {
+
+float _signNotZero(float v)
+{
+  return v >= 0.0f ? 1.0f : -1.0f;
+}
+
+} // anonymous namespace
+
+void OctahedralNormal::init(const Vector3& n)
+{
+  // Project onto the octahedron |x| + |y| + |z| = 1, then fold the lower
+  // hemisphere over the diagonals of the upper one
+  float invL1 = 1.0f / (fabsf(n.x) + fabsf(n.y) + fabsf(n.z));
+  float px = n.x * invL1;
+  float py = n.y * invL1;
+  if (n.z < 0.0f) {
+    float fx = (1.0f - fabsf(py)) * _signNotZero(px);
+    float fy = (1.0f - fabsf(px)) * _signNotZero(py);
+    px = fx;
+    py = fy;
+  }
+  x = FloatToSnorm16(px);
+  y = FloatToSnorm16(py);
+}
+
+OctahedralNormal OctahedralNormal::Create(const Vector3& n)
+{
+  OctahedralNormal r;
+  r.init(n);
+  return r;
+}
+
+Vector3 OctahedralNormal::asVector3() const
+{
+  float px = Snorm16ToFloat(x);
+  float py = Snorm16ToFloat(y);
+  float pz = 1.0f - fabsf(px) - fabsf(py);
+  if (pz < 0.0f) {
+    // Unfold the lower hemisphere
+    float t = -pz;
+    px += px >= 0.0f ? -t : t;
+    py += py >= 0.0f ? -t : t;
+  }
+  return Vector3::Normalize(Vector3::Create(px, py, pz));
+}
+
+bool OctahedralNormal::operator ==(const OctahedralNormal& b) const
+{
+  return x == b.x && y == b.y;
+}
+
+bool OctahedralNormal::operator !=(const OctahedralNormal& b) const
+{
+  return x != b.x || y != b.y;
+}
+
+void OctahedralNormal::Pack(const Vector3* n, OctahedralNormal* out, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("OctahedralNormal::Pack");
+  for (size_t i = 0; i < count; i++) {
+    out[i].init(n[i]);
+  }
+}
+
+void OctahedralNormal::Unpack(const OctahedralNormal* n, Vector3* out, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("OctahedralNormal::Unpack");
+  for (size_t i = 0; i < count; i++) {
+    out[i] = n[i].asVector3();
+  }
+}
+
+} // namespace hydra
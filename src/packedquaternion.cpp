@@ -0,0 +1,181 @@
+//
+//  packedquaternion.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+
+namespace hydra {
+
+namespace {
+
+const float SQRT2 = 1.41421356f;
+
+// Encodes q as the index of its largest component followed by the other
+// three components quantized to componentBits each, most significant first
+uint64_t _packSmallestThree(const Quaternion& q, int componentBits)
+{
+  int largest = 0;
+  for (int i = 1; i < 4; i++) {
+    if (fabsf(q.c[i]) > fabsf(q.c[largest])) {
+      largest = i;
+    }
+  }
+  float sign = q.c[largest] < 0.0f ? -1.0f : 1.0f;
+  float maxValue = (float)((1 << componentBits) - 1);
+
+  uint64_t bits = (uint64_t)largest;
+  for (int i = 0; i < 4; i++) {
+    if (i == largest) {
+      continue;
+    }
+    float v = (q.c[i] * sign * SQRT2 + 1.0f) * 0.5f;
+    v = v > 0.0f ? v : 0.0f;
+    v = v < 1.0f ? v : 1.0f;
+    bits = (bits << componentBits) | (uint64_t)lrintf(v * maxValue);
+  }
+  return bits;
+}
+
+Quaternion _unpackSmallestThree(uint64_t bits, int componentBits)
+{
+  uint64_t mask = ((uint64_t)1 << componentBits) - 1;
+  float scale = 1.0f / (float)mask;
+  int largest = (int)(bits >> (componentBits * 3)) & 3;
+
+  Quaternion q;
+  float sum = 0.0f;
+  int shift = componentBits * 2;
+  for (int i = 0; i < 4; i++) {
+    if (i == largest) {
+      continue;
+    }
+    float v = ((float)((bits >> shift) & mask) * scale * 2.0f - 1.0f) * (1.0f / SQRT2);
+    q.c[i] = v;
+    sum += v * v;
+    shift -= componentBits;
+  }
+  float w = 1.0f - sum;
+  q.c[largest] = w > 0.0f ? sqrtf(w) : 0.0f;
+  return q;
+}
+
+} // anonymous namespace
+
+void PackedQuaternion32::init(const Quaternion& q)
+{
+  bits = (uint32_t)_packSmallestThree(q, 10);
+}
+
+PackedQuaternion32 PackedQuaternion32::Create(const Quaternion& q)
+{
+  PackedQuaternion32 r;
+  r.init(q);
+  return r;
+}
+
+Quaternion PackedQuaternion32::asQuaternion() const
+{
+  return _unpackSmallestThree(bits, 10);
+}
+
+bool PackedQuaternion32::operator ==(const PackedQuaternion32& b) const
+{
+  return bits == b.bits;
+}
+
+bool PackedQuaternion32::operator !=(const PackedQuaternion32& b) const
+{
+  return bits != b.bits;
+}
+
+void PackedQuaternion32::Pack(const Quaternion* q, PackedQuaternion32* out, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("PackedQuaternion32::Pack");
+  for (size_t i = 0; i < count; i++) {
+    out[i].init(q[i]);
+  }
+}
+
+void PackedQuaternion32::Unpack(const PackedQuaternion32* q, Quaternion* out, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("PackedQuaternion32::Unpack");
+  for (size_t i = 0; i < count; i++) {
+    out[i] = q[i].asQuaternion();
+  }
+}
+
+void PackedQuaternion48::init(const Quaternion& q)
+{
+  uint64_t bits = _packSmallestThree(q, 15);
+  c[0] = (uint16_t)(bits >> 32);
+  c[1] = (uint16_t)(bits >> 16);
+  c[2] = (uint16_t)bits;
+}
+
+PackedQuaternion48 PackedQuaternion48::Create(const Quaternion& q)
+{
+  PackedQuaternion48 r;
+  r.init(q);
+  return r;
+}
+
+Quaternion PackedQuaternion48::asQuaternion() const
+{
+  uint64_t bits = ((uint64_t)c[0] << 32) | ((uint64_t)c[1] << 16) | (uint64_t)c[2];
+  return _unpackSmallestThree(bits, 15);
+}
+
+bool PackedQuaternion48::operator ==(const PackedQuaternion48& b) const
+{
+  return c[0] == b.c[0] && c[1] == b.c[1] && c[2] == b.c[2];
+}
+
+bool PackedQuaternion48::operator !=(const PackedQuaternion48& b) const
+{
+  return c[0] != b.c[0] || c[1] != b.c[1] || c[2] != b.c[2];
+}
+
+void PackedQuaternion48::Pack(const Quaternion* q, PackedQuaternion48* out, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("PackedQuaternion48::Pack");
+  for (size_t i = 0; i < count; i++) {
+    out[i].init(q[i]);
+  }
+}
+
+void PackedQuaternion48::Unpack(const PackedQuaternion48* q, Quaternion* out, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("PackedQuaternion48::Unpack");
+  for (size_t i = 0; i < count; i++) {
+    out[i] = q[i].asQuaternion();
+  }
+}
+
+} // namespace hydra
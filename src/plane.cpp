@@ -0,0 +1,372 @@
+//
+//  plane.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+#include "krhelpers.h"
+
+namespace hydra {
+
+namespace {
+
+Vector3 _intersectEdge(const Vector3& a, const Vector3& b, float da, float db)
+{
+  // da and db have opposite signs, so the denominator is non-zero
+  return a + (b - a) * (da / (da - db));
+}
+
+} // anonymous namespace
+
+void Plane::init()
+{
+  normal = Vector3::Up();
+  d = 0.0f;
+}
+
+Plane Plane::Create()
+{
+  Plane r;
+  r.init();
+  return r;
+}
+
+void Plane::init(const Vector3& planeNormal, float planeDistance)
+{
+  normal = planeNormal;
+  d = planeDistance;
+}
+
+Plane Plane::Create(const Vector3& planeNormal, float planeDistance)
+{
+  Plane r;
+  r.init(planeNormal, planeDistance);
+  return r;
+}
+
+void Plane::init(const Vector3& planeNormal, const Vector3& point)
+{
+  normal = planeNormal;
+  d = Vector3::Dot(planeNormal, point);
+}
+
+Plane Plane::Create(const Vector3& planeNormal, const Vector3& point)
+{
+  Plane r;
+  r.init(planeNormal, point);
+  return r;
+}
+
+void Plane::init(const Vector3& v1, const Vector3& v2, const Vector3& v3)
+{
+  normal = Vector3::Normalize(Vector3::Cross(v2 - v1, v3 - v1));
+  d = Vector3::Dot(normal, v1);
+}
+
+Plane Plane::Create(const Vector3& v1, const Vector3& v2, const Vector3& v3)
+{
+  Plane r;
+  r.init(v1, v2, v3);
+  return r;
+}
+
+void Plane::init(const Triangle3& tri)
+{
+  init(tri[0], tri[1], tri[2]);
+}
+
+Plane Plane::Create(const Triangle3& tri)
+{
+  Plane r;
+  r.init(tri);
+  return r;
+}
+
+void Plane::init(const Vector4& v)
+{
+  normal = Vector3::Create(v);
+  d = v.w;
+}
+
+Plane Plane::Create(const Vector4& v)
+{
+  Plane r;
+  r.init(v);
+  return r;
+}
+
+Vector4 Plane::asVector4() const
+{
+  return Vector4::Create(normal, d);
+}
+
+void Plane::normalize()
+{
+  float length = normal.magnitude();
+  if (length > 0.0f) {
+    float inv_length = 1.0f / length;
+    normal *= inv_length;
+    d *= inv_length;
+  }
+}
+
+Plane Plane::Normalize(const Plane& p)
+{
+  Plane r = p;
+  r.normalize();
+  return r;
+}
+
+void Plane::flip()
+{
+  normal = -normal;
+  d = -d;
+}
+
+float Plane::distance(const Vector3& p) const
+{
+  return Vector3::Dot(normal, p) - d;
+}
+
+PlaneSide Plane::classify(const Vector3& p, float epsilon) const
+{
+  float dist = distance(p);
+  if (dist > epsilon) {
+    return PlaneSide::FRONT;
+  }
+  if (dist < -epsilon) {
+    return PlaneSide::BACK;
+  }
+  return PlaneSide::ON;
+}
+
+Vector3 Plane::project(const Vector3& p) const
+{
+  return p - normal * (distance(p) / normal.sqrMagnitude());
+}
+
+bool Plane::intersectsRay(const Vector3& start, const Vector3& dir, float& rayDistance) const
+{
+  float denom = Vector3::Dot(normal, dir);
+  if (denom == 0.0f) {
+    return false; // Parallel
+  }
+  float t = -distance(start) / denom;
+  if (t < 0.0f) {
+    return false;
+  }
+  rayDistance = t;
+  return true;
+}
+
+void Plane::transform(const Matrix4& m)
+{
+  *this = Transform(*this, m);
+}
+
+Plane Plane::Transform(const Plane& p, const Matrix4& m)
+{
+  Plane r;
+  Transform(&p, 1, m, &r);
+  return r;
+}
+
+void Plane::Transform(const Plane* planes, size_t count, const Matrix4& m, Plane* out)
+{
+  HYDRA_PROFILE_SCOPE("Plane::Transform(batch)");
+  // In homogeneous form the plane is the row vector (normal, -d), which
+  // transforms by the inverse of m applied from the right; equivalently, by
+  // the inverse-transpose applied from the left.  Each component of the
+  // result is the dot product with one column of the inverse.
+  Matrix4 inv = Matrix4::Invert(m);
+  for (size_t i = 0; i < count; i++) {
+    Vector4 v = Vector4::Create(planes[i].normal, -planes[i].d);
+    Plane r;
+    r.normal.x = Vector4::Dot(inv.axis_x, v);
+    r.normal.y = Vector4::Dot(inv.axis_y, v);
+    r.normal.z = Vector4::Dot(inv.axis_z, v);
+    r.d = -Vector4::Dot(inv.transform, v);
+    r.normalize();
+    out[i] = r;
+  }
+}
+
+bool Plane::operator ==(const Plane& b) const
+{
+  return normal == b.normal && d == b.d;
+}
+
+bool Plane::operator !=(const Plane& b) const
+{
+  return !(*this == b);
+}
+
+void Plane::Distances(const Plane& plane, const Vector3* points, size_t count, float* distances)
+{
+  HYDRA_PROFILE_SCOPE("Plane::Distances");
+  float nx = plane.normal.x;
+  float ny = plane.normal.y;
+  float nz = plane.normal.z;
+  float pd = plane.d;
+  for (size_t i = 0; i < count; i++) {
+    distances[i] = nx * points[i].x + ny * points[i].y + nz * points[i].z - pd;
+  }
+}
+
+PlaneSide Plane::Classify(const Plane& plane, const Vector3* points, size_t count, float epsilon, PlaneSide* sides)
+{
+  HYDRA_PROFILE_SCOPE("Plane::Classify");
+  bool anyFront = false;
+  bool anyBack = false;
+  for (size_t i = 0; i < count; i++) {
+    PlaneSide side = plane.classify(points[i], epsilon);
+    anyFront |= side == PlaneSide::FRONT;
+    anyBack |= side == PlaneSide::BACK;
+    if (sides) {
+      sides[i] = side;
+    }
+  }
+  if (anyFront && anyBack) {
+    return PlaneSide::SPANNING;
+  }
+  if (anyFront) {
+    return PlaneSide::FRONT;
+  }
+  if (anyBack) {
+    return PlaneSide::BACK;
+  }
+  return PlaneSide::ON;
+}
+
+size_t Plane::ClipPolygon(const Plane& plane, const Vector3* polygon, size_t count, Vector3* out)
+{
+  HYDRA_PROFILE_SCOPE("Plane::ClipPolygon");
+  size_t outCount = 0;
+  if (count == 0) {
+    return 0;
+  }
+  const Vector3* prev = &polygon[count - 1];
+  float prevDistance = plane.distance(*prev);
+  for (size_t i = 0; i < count; i++) {
+    const Vector3* cur = &polygon[i];
+    float curDistance = plane.distance(*cur);
+    if (curDistance >= 0.0f) {
+      if (prevDistance < 0.0f) {
+        out[outCount++] = _intersectEdge(*prev, *cur, prevDistance, curDistance);
+      }
+      out[outCount++] = *cur;
+    } else if (prevDistance >= 0.0f) {
+      out[outCount++] = _intersectEdge(*prev, *cur, prevDistance, curDistance);
+    }
+    prev = cur;
+    prevDistance = curDistance;
+  }
+  return outCount;
+}
+
+size_t Plane::ClipPolygon(const Plane* planes, int planeCount, const Vector3* polygon, size_t count, Vector3* out, Vector3* scratch)
+{
+  HYDRA_PROFILE_SCOPE("Plane::ClipPolygon(planes)");
+  if (planeCount <= 0) {
+    for (size_t i = 0; i < count; i++) {
+      out[i] = polygon[i];
+    }
+    return count;
+  }
+
+  // Alternate between the two buffers so that the last pass lands in out
+  Vector3* buffers[2] = { out, scratch };
+  int target = (planeCount & 1) == 0 ? 1 : 0;
+  const Vector3* source = polygon;
+  for (int i = 0; i < planeCount && count > 0; i++) {
+    count = ClipPolygon(planes[i], source, count, buffers[target]);
+    source = buffers[target];
+    target ^= 1;
+  }
+  if (source != out) {
+    for (size_t i = 0; i < count; i++) {
+      out[i] = source[i];
+    }
+  }
+  return count;
+}
+
+void Plane::SplitPolygon(const Plane& plane, const Vector3* polygon, size_t count, Vector3* front, size_t& frontCount, Vector3* back, size_t& backCount)
+{
+  HYDRA_PROFILE_SCOPE("Plane::SplitPolygon");
+  frontCount = 0;
+  backCount = 0;
+  if (count == 0) {
+    return;
+  }
+  const Vector3* prev = &polygon[count - 1];
+  float prevDistance = plane.distance(*prev);
+  for (size_t i = 0; i < count; i++) {
+    const Vector3* cur = &polygon[i];
+    float curDistance = plane.distance(*cur);
+    if ((curDistance > 0.0f && prevDistance < 0.0f) || (curDistance < 0.0f && prevDistance > 0.0f)) {
+      Vector3 p = _intersectEdge(*prev, *cur, prevDistance, curDistance);
+      front[frontCount++] = p;
+      back[backCount++] = p;
+    }
+    if (curDistance >= 0.0f) {
+      front[frontCount++] = *cur;
+    }
+    if (curDistance <= 0.0f) {
+      back[backCount++] = *cur;
+    }
+    prev = cur;
+    prevDistance = curDistance;
+  }
+  // A polygon touching the plane only along an edge or vertex leaves a
+  // degenerate sliver on that side
+  if (frontCount < 3) {
+    frontCount = 0;
+  }
+  if (backCount < 3) {
+    backCount = 0;
+  }
+}
+
+size_t Plane::ClipTriangle(const Plane& plane, const Triangle3& tri, Triangle3* out)
+{
+  Vector3 polygon[4];
+  size_t count = ClipPolygon(plane, tri.vert, 3, polygon);
+  if (count < 3) {
+    return 0;
+  }
+  out[0] = Triangle3::Create(polygon[0], polygon[1], polygon[2]);
+  if (count == 3) {
+    return 1;
+  }
+  out[1] = Triangle3::Create(polygon[0], polygon[2], polygon[3]);
+  return 2;
+}
+
+} // namespace hydra
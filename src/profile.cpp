@@ -0,0 +1,199 @@
+//
+//  profile.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string.h>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define HYDRA_PROFILE_RDTSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HYDRA_PROFILE_RDTSC
+#else
+#include <chrono>
+#endif
+
+namespace hydra {
+
+namespace {
+
+// Written only by the owning thread, and read by Report() from any thread
+struct ThreadCounters
+{
+  std::atomic<uint64_t> calls[Profile::MAX_SITES];
+  std::atomic<uint64_t> cycles[Profile::MAX_SITES];
+
+  ThreadCounters();
+  ~ThreadCounters();
+};
+
+struct ProfileRegistry
+{
+  std::mutex mutex; // Protects all members
+  const char* names[Profile::MAX_SITES];
+  int siteCount;
+  std::vector<ThreadCounters*> threads;
+  // Counts of exited threads
+  uint64_t retiredCalls[Profile::MAX_SITES];
+  uint64_t retiredCycles[Profile::MAX_SITES];
+  // Totals at the last Reset(), subtracted from later reports
+  uint64_t baseCalls[Profile::MAX_SITES];
+  uint64_t baseCycles[Profile::MAX_SITES];
+};
+
+ProfileRegistry& _registry()
+{
+  // Constructed on first use, as sites may be registered during static
+  // initialization of other translation units
+  static ProfileRegistry registry = {};
+  return registry;
+}
+
+ThreadCounters::ThreadCounters()
+{
+  for (int i = 0; i < Profile::MAX_SITES; i++) {
+    calls[i] = 0;
+    cycles[i] = 0;
+  }
+  ProfileRegistry& registry = _registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.threads.push_back(this);
+}
+
+ThreadCounters::~ThreadCounters()
+{
+  ProfileRegistry& registry = _registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (int i = 0; i < Profile::MAX_SITES; i++) {
+    registry.retiredCalls[i] += calls[i].load(std::memory_order_relaxed);
+    registry.retiredCycles[i] += cycles[i].load(std::memory_order_relaxed);
+  }
+  registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), this));
+}
+
+thread_local ThreadCounters _threadCounters;
+
+// Sums the counters of all threads.  The registry mutex must be held.
+void _totals(ProfileRegistry& registry, uint64_t* calls, uint64_t* cycles)
+{
+  for (int i = 0; i < Profile::MAX_SITES; i++) {
+    calls[i] = registry.retiredCalls[i];
+    cycles[i] = registry.retiredCycles[i];
+    for (size_t t = 0; t < registry.threads.size(); t++) {
+      calls[i] += registry.threads[t]->calls[i].load(std::memory_order_relaxed);
+      cycles[i] += registry.threads[t]->cycles[i].load(std::memory_order_relaxed);
+    }
+  }
+}
+
+} // anonymous namespace
+
+bool Profile::Enabled()
+{
+#ifdef HYDRA_PROFILE
+  return true;
+#else
+  return false;
+#endif
+}
+
+uint64_t Profile::Cycles()
+{
+#ifdef HYDRA_PROFILE_RDTSC
+  return __rdtsc();
+#else
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+int Profile::RegisterSite(const char* name)
+{
+  ProfileRegistry& registry = _registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (int i = 0; i < registry.siteCount; i++) {
+    if (strcmp(registry.names[i], name) == 0) {
+      return i;
+    }
+  }
+  if (registry.siteCount == MAX_SITES) {
+    return -1;
+  }
+  registry.names[registry.siteCount] = name;
+  return registry.siteCount++;
+}
+
+void Profile::Record(int site, uint64_t cycles)
+{
+  if (site < 0) {
+    return;
+  }
+  // Only this thread writes its counters, so a load and a store suffice
+  ThreadCounters& counters = _threadCounters;
+  counters.calls[site].store(counters.calls[site].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  counters.cycles[site].store(counters.cycles[site].load(std::memory_order_relaxed) + cycles, std::memory_order_relaxed);
+}
+
+void Profile::Report(std::vector<ProfileCounter>& counters)
+{
+  counters.clear();
+  ProfileRegistry& registry = _registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  uint64_t calls[MAX_SITES];
+  uint64_t cycles[MAX_SITES];
+  _totals(registry, calls, cycles);
+  for (int i = 0; i < registry.siteCount; i++) {
+    if (calls[i] == registry.baseCalls[i]) {
+      continue;
+    }
+    ProfileCounter counter;
+    counter.name = registry.names[i];
+    counter.calls = calls[i] - registry.baseCalls[i];
+    counter.cycles = cycles[i] - registry.baseCycles[i];
+    counters.push_back(counter);
+  }
+  std::sort(counters.begin(), counters.end(), [](const ProfileCounter& a, const ProfileCounter& b) {
+    return a.cycles > b.cycles;
+  });
+}
+
+void Profile::Reset()
+{
+  ProfileRegistry& registry = _registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  _totals(registry, registry.baseCalls, registry.baseCycles);
+}
+
+} // namespace hydra
@@ -43,13 +43,6 @@ void Quaternion::init()
   c[3] = 0.0;
 }
 
-Quaternion Quaternion::Create()
-{
-  Quaternion r;
-  r.init();
-  return r;
-}
-
 void Quaternion::init(float w, float x, float y, float z)
 {
   c[0] = w;
@@ -58,13 +51,6 @@ void Quaternion::init(float w, float x, float y, float z)
   c[3] = z;
 }
 
-Quaternion Quaternion::Create(float w, float x, float y, float z)
-{
-  Quaternion r;
-  r.init(w, x, y, z);
-  return r;
-}
-
 void Quaternion::init(const Quaternion& p)
 {
   c[0] = p[0];
@@ -73,13 +59,6 @@ void Quaternion::init(const Quaternion& p)
   c[3] = p[3];
 }
 
-Quaternion Quaternion::Create(const Quaternion& p)
-{
-  Quaternion r;
-  r.init(p);
-  return r;
-}
-
 void Quaternion::init(const Vector3& euler)
 {
   setEulerZYX(euler);
@@ -94,6 +73,7 @@ Quaternion Quaternion::Create(const Vector3& euler)
 
 void Quaternion::init(const Vector3& from_vector, const Vector3& to_vector)
 {
+  HYDRA_PROFILE_SCOPE("Quaternion::init(from, to)");
 
   Vector3 a = Vector3::Cross(from_vector, to_vector);
   c[0] = a[0];
@@ -112,6 +92,7 @@ Quaternion Quaternion::Create(const Vector3& from_vector, const Vector3& to_vect
 
 void Quaternion::setEulerXYZ(const Vector3& euler)
 {
+  HYDRA_PROFILE_SCOPE("Quaternion::setEulerXYZ");
   *this = Quaternion::FromAngleAxis(Vector3::Create(1.0f, 0.0f, 0.0f), euler.x)
     * Quaternion::FromAngleAxis(Vector3::Create(0.0f, 1.0f, 0.0f), euler.y)
     * Quaternion::FromAngleAxis(Vector3::Create(0.0f, 0.0f, 1.0f), euler.z);
@@ -119,6 +100,7 @@ void Quaternion::setEulerXYZ(const Vector3& euler)
 
 void Quaternion::setEulerZYX(const Vector3& euler)
 {
+  HYDRA_PROFILE_SCOPE("Quaternion::setEulerZYX");
   // ZYX Order!
   float c1 = cosf(euler[0] * 0.5f);
   float c2 = cosf(euler[1] * 0.5f);
@@ -145,6 +127,7 @@ float& Quaternion::operator [](unsigned i)
 
 Vector3 Quaternion::eulerXYZ() const
 {
+  HYDRA_PROFILE_SCOPE("Quaternion::eulerXYZ");
   float a2 = 2 * (c[0] * c[2] - c[1] * c[3]);
   if (a2 <= -0.99999) {
     return Vector3::Create(
@@ -187,48 +170,6 @@ bool operator !=(Quaternion& v1, Quaternion& v2)
     || v1[3] != v2[3];
 }
 
-Quaternion Quaternion::operator *(const Quaternion& v)
-{
-  float t0 = (c[3] - c[2]) * (v[2] - v[3]);
-  float t1 = (c[0] + c[1]) * (v[0] + v[1]);
-  float t2 = (c[0] - c[1]) * (v[2] + v[3]);
-  float t3 = (c[3] + c[2]) * (v[0] - v[1]);
-  float t4 = (c[3] - c[1]) * (v[1] - v[2]);
-  float t5 = (c[3] + c[1]) * (v[1] + v[2]);
-  float t6 = (c[0] + c[2]) * (v[0] - v[3]);
-  float t7 = (c[0] - c[2]) * (v[0] + v[3]);
-  float t8 = t5 + t6 + t7;
-  float t9 = (t4 + t8) / 2;
-
-  return Quaternion::Create(
-      t0 + t9 - t5,
-      t1 + t9 - t8,
-      t2 + t9 - t7,
-      t3 + t9 - t6
-  );
-}
-
-Quaternion Quaternion::operator *(float v) const
-{
-  return Quaternion::Create(c[0] * v, c[1] * v, c[2] * v, c[3] * v);
-}
-
-Quaternion Quaternion::operator /(float num) const
-{
-  float inv_num = 1.0f / num;
-  return Quaternion::Create(c[0] * inv_num, c[1] * inv_num, c[2] * inv_num, c[3] * inv_num);
-}
-
-Quaternion Quaternion::operator +(const Quaternion& v) const
-{
-  return Quaternion::Create(c[0] + v[0], c[1] + v[1], c[2] + v[2], c[3] + v[3]);
-}
-
-Quaternion Quaternion::operator -(const Quaternion& v) const
-{
-  return Quaternion::Create(c[0] - v[0], c[1] - v[1], c[2] - v[2], c[3] - v[3]);
-}
-
 Quaternion& Quaternion::operator +=(const Quaternion& v)
 {
   c[0] += v[0];
@@ -287,16 +228,6 @@ Quaternion& Quaternion::operator /=(const float& v)
   return *this;
 }
 
-Quaternion Quaternion::operator +() const
-{
-  return *this;
-}
-
-Quaternion Quaternion::operator -() const
-{
-  return Quaternion::Create(-c[0], -c[1], -c[2], -c[3]);
-}
-
 Quaternion Quaternion::Normalize(const Quaternion& v1)
 {
   float inv_magnitude = 1.0f / sqrtf(v1[0] * v1[0] + v1[1] * v1[1] + v1[2] * v1[2] + v1[3] * v1[3]);
@@ -317,11 +248,6 @@ void Quaternion::normalize()
   c[3] *= inv_magnitude;
 }
 
-Quaternion Quaternion::Conjugate(const Quaternion& v1)
-{
-  return Quaternion::Create(v1[0], -v1[1], -v1[2], -v1[3]);
-}
-
 void Quaternion::conjugate()
 {
   c[1] = -c[1];
@@ -342,6 +268,7 @@ Quaternion Quaternion::Invert(const Quaternion& v1)
 
 Matrix4 Quaternion::rotationMatrix() const
 {
+  HYDRA_PROFILE_SCOPE("Quaternion::rotationMatrix");
   Matrix4 matRotate;
   matRotate.init();
 
@@ -374,6 +301,7 @@ Matrix4 Quaternion::rotationMatrix() const
 
 Quaternion Quaternion::FromAngleAxis(const Vector3& axis, float angle)
 {
+  HYDRA_PROFILE_SCOPE("Quaternion::FromAngleAxis");
   float ha = angle * 0.5f;
   float sha = sinf(ha);
   return Quaternion::Create(cosf(ha), axis.x * sha, axis.y * sha, axis.z * sha);
@@ -381,6 +309,7 @@ Quaternion Quaternion::FromAngleAxis(const Vector3& axis, float angle)
 
 Quaternion Quaternion::FromRotationMatrix(const Matrix4& m)
 {
+  HYDRA_PROFILE_SCOPE("Quaternion::FromRotationMatrix");
   // see http://www.euclideanspace.com/maths/geometry/rotations/conversions/matrixToQuaternion/index.htm
   const float trace = m[0] + m[5] + m[10];
   float w, x, y, z;
@@ -412,13 +341,9 @@ Quaternion Quaternion::FromRotationMatrix(const Matrix4& m)
   return Quaternion::Create(w, x, y, z);
 }
 
-float Quaternion::Dot(const Quaternion& v1, const Quaternion& v2)
-{
-  return v1.c[0] * v2.c[0] + v1.c[1] * v2.c[1] + v1.c[2] * v2.c[2] + v1.c[3] * v2.c[3];
-}
-
 Quaternion Quaternion::Lerp(const Quaternion& a, const Quaternion& b, float t)
 {
+  HYDRA_PROFILE_SCOPE("Quaternion::Lerp");
   if (t <= 0.0f) {
     return a;
   } else if (t >= 1.0f) {
@@ -430,6 +355,7 @@ Quaternion Quaternion::Lerp(const Quaternion& a, const Quaternion& b, float t)
 
 Quaternion Quaternion::Slerp(const Quaternion& a, const Quaternion& b, float t)
 {
+  HYDRA_PROFILE_SCOPE("Quaternion::Slerp");
   if (t <= 0.0f) {
     return a;
   }
@@ -0,0 +1,224 @@
+//
+//  quaterniond.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+
+namespace hydra {
+
+void Quaterniond::init()
+{
+  c[0] = 1.0;
+  c[1] = 0.0;
+  c[2] = 0.0;
+  c[3] = 0.0;
+}
+
+void Quaterniond::init(double w, double x, double y, double z)
+{
+  c[0] = w;
+  c[1] = x;
+  c[2] = y;
+  c[3] = z;
+}
+
+void Quaterniond::init(const Quaterniond& p)
+{
+  c[0] = p[0];
+  c[1] = p[1];
+  c[2] = p[2];
+  c[3] = p[3];
+}
+
+void Quaterniond::init(const Quaternion& p)
+{
+  c[0] = p[0];
+  c[1] = p[1];
+  c[2] = p[2];
+  c[3] = p[3];
+}
+
+double Quaterniond::operator [](unsigned i) const
+{
+  return c[i];
+}
+
+double& Quaterniond::operator [](unsigned i)
+{
+  return c[i];
+}
+
+Quaterniond& Quaterniond::operator +=(const Quaterniond& v)
+{
+  c[0] += v[0];
+  c[1] += v[1];
+  c[2] += v[2];
+  c[3] += v[3];
+  return *this;
+}
+
+Quaterniond& Quaterniond::operator -=(const Quaterniond& v)
+{
+  c[0] -= v[0];
+  c[1] -= v[1];
+  c[2] -= v[2];
+  c[3] -= v[3];
+  return *this;
+}
+
+Quaterniond& Quaterniond::operator *=(const Quaterniond& v)
+{
+  *this = *this * v;
+  return *this;
+}
+
+Quaterniond& Quaterniond::operator *=(const double& v)
+{
+  c[0] *= v;
+  c[1] *= v;
+  c[2] *= v;
+  c[3] *= v;
+  return *this;
+}
+
+Quaterniond& Quaterniond::operator /=(const double& v)
+{
+  double inv_v = 1.0 / v;
+  c[0] *= inv_v;
+  c[1] *= inv_v;
+  c[2] *= inv_v;
+  c[3] *= inv_v;
+  return *this;
+}
+
+Quaterniond Quaterniond::Normalize(const Quaterniond& v1)
+{
+  double inv_magnitude = 1.0 / sqrt(v1[0] * v1[0] + v1[1] * v1[1] + v1[2] * v1[2] + v1[3] * v1[3]);
+  return Quaterniond::Create(
+      v1[0] * inv_magnitude,
+      v1[1] * inv_magnitude,
+      v1[2] * inv_magnitude,
+      v1[3] * inv_magnitude
+  );
+}
+
+void Quaterniond::normalize()
+{
+  *this = Normalize(*this);
+}
+
+void Quaterniond::conjugate()
+{
+  c[1] = -c[1];
+  c[2] = -c[2];
+  c[3] = -c[3];
+}
+
+void Quaterniond::invert()
+{
+  conjugate();
+  normalize();
+}
+
+Quaterniond Quaterniond::Invert(const Quaterniond& v1)
+{
+  return Normalize(Conjugate(v1));
+}
+
+Matrix4d Quaterniond::rotationMatrix() const
+{
+  HYDRA_PROFILE_SCOPE("Quaterniond::rotationMatrix");
+  // Same layout as Quaternion::rotationMatrix
+  Matrix4d matRotate = Matrix4d::Identity();
+
+  matRotate.c[0] = 1.0 - 2.0 * (c[2] * c[2] + c[3] * c[3]);
+  matRotate.c[1] = 2.0 * (c[1] * c[2] - c[0] * c[3]);
+  matRotate.c[2] = 2.0 * (c[0] * c[2] + c[1] * c[3]);
+
+  matRotate.c[4] = 2.0 * (c[1] * c[2] + c[0] * c[3]);
+  matRotate.c[5] = 1.0 - 2.0 * (c[1] * c[1] + c[3] * c[3]);
+  matRotate.c[6] = 2.0 * (c[2] * c[3] - c[0] * c[1]);
+
+  matRotate.c[8] = 2.0 * (c[1] * c[3] - c[0] * c[2]);
+  matRotate.c[9] = 2.0 * (c[0] * c[1] + c[2] * c[3]);
+  matRotate.c[10] = 1.0 - 2.0 * (c[1] * c[1] + c[2] * c[2]);
+
+  return matRotate;
+}
+
+Quaterniond Quaterniond::FromAngleAxis(const Vector3d& axis, double angle)
+{
+  double ha = angle * 0.5;
+  double sha = sin(ha);
+  return Quaterniond::Create(cos(ha), axis.x * sha, axis.y * sha, axis.z * sha);
+}
+
+Quaterniond Quaterniond::Lerp(const Quaterniond& a, const Quaterniond& b, double t)
+{
+  if (t <= 0.0) {
+    return a;
+  } else if (t >= 1.0) {
+    return b;
+  }
+
+  return a * (1.0 - t) + b * t;
+}
+
+Quaterniond Quaterniond::Slerp(const Quaterniond& a, const Quaterniond& b, double t)
+{
+  HYDRA_PROFILE_SCOPE("Quaterniond::Slerp");
+  if (t <= 0.0) {
+    return a;
+  }
+
+  if (t >= 1.0) {
+    return b;
+  }
+
+  double coshalftheta = Dot(a, b);
+  Quaterniond c = a;
+
+  // Take the shorter arc; q and -q are the same rotation
+  if (coshalftheta < 0.0) {
+    coshalftheta = -coshalftheta;
+    c = -c;
+  }
+
+  if (coshalftheta > (1.0 - std::numeric_limits<double>::epsilon())) {
+    // Angle is tiny - save some computation by lerping instead.
+    return Lerp(c, b, t);
+  }
+
+  double halftheta = acos(coshalftheta);
+
+  return (c * sin((1.0 - t) * halftheta) + b * sin(t * halftheta)) / sin(halftheta);
+}
+
+} // namespace hydra
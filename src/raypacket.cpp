@@ -0,0 +1,121 @@
+//
+//  raypacket.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+#include "assert.h"
+
+namespace hydra {
+
+void RayPacket::init(int rayCount)
+{
+  assert(rayCount >= 0 && rayCount <= MAX_RAYS);
+  count = rayCount;
+  active_mask = 0;
+  for (int i = 0; i < MAX_RAYS; i++) {
+    origin_x[i] = 0.0f;
+    origin_y[i] = 0.0f;
+    origin_z[i] = 0.0f;
+    dir_x[i] = 0.0f;
+    dir_y[i] = 0.0f;
+    dir_z[i] = 0.0f;
+    inv_dir_x[i] = std::numeric_limits<float>::infinity();
+    inv_dir_y[i] = std::numeric_limits<float>::infinity();
+    inv_dir_z[i] = std::numeric_limits<float>::infinity();
+    max_distance[i] = -1.0f;
+  }
+}
+
+RayPacket RayPacket::Create(int rayCount)
+{
+  RayPacket r;
+  r.init(rayCount);
+  return r;
+}
+
+void RayPacket::init(const Vector3* starts, const Vector3* dirs, int rayCount)
+{
+  init(rayCount);
+  for (int i = 0; i < rayCount; i++) {
+    setRay(i, starts[i], dirs[i]);
+  }
+}
+
+RayPacket RayPacket::Create(const Vector3* starts, const Vector3* dirs, int rayCount)
+{
+  RayPacket r;
+  r.init(starts, dirs, rayCount);
+  return r;
+}
+
+void RayPacket::setRay(int i, const Vector3& start, const Vector3& dir)
+{
+  setRay(i, start, dir, std::numeric_limits<float>::max());
+}
+
+void RayPacket::setRay(int i, const Vector3& start, const Vector3& dir, float maxDistance)
+{
+  assert(i >= 0 && i < count);
+  origin_x[i] = start.x;
+  origin_y[i] = start.y;
+  origin_z[i] = start.z;
+  dir_x[i] = dir.x;
+  dir_y[i] = dir.y;
+  dir_z[i] = dir.z;
+  // Division by zero is intended here; the resulting infinities make the slab
+  // test in the BVH traversal reject or accept the axis as appropriate.
+  inv_dir_x[i] = 1.0f / dir.x;
+  inv_dir_y[i] = 1.0f / dir.y;
+  inv_dir_z[i] = 1.0f / dir.z;
+  max_distance[i] = maxDistance;
+  active_mask |= (1u << i);
+}
+
+void RayPacket::deactivate(int i)
+{
+  active_mask &= ~(1u << i);
+}
+
+bool RayPacket::isActive(int i) const
+{
+  return (active_mask & (1u << i)) != 0;
+}
+
+Vector3 RayPacket::origin(int i) const
+{
+  return Vector3::Create(origin_x[i], origin_y[i], origin_z[i]);
+}
+
+Vector3 RayPacket::direction(int i) const
+{
+  return Vector3::Create(dir_x[i], dir_y[i], dir_z[i]);
+}
+
+} // namespace hydra
@@ -31,6 +31,9 @@
 
 #include "../include/hydra.h"
 
+#include <math.h>
+#include <string.h>
+
 namespace hydra {
 
 float SmoothStep(float a, float b, float t)
@@ -44,4 +47,70 @@ float Lerp(float a, float b, float t)
   return (a + (b - a) * t);
 }
 
+uint16_t FloatToHalf(float v)
+{
+  uint32_t f;
+  memcpy(&f, &v, sizeof(f));
+  uint32_t sign = f & 0x80000000u;
+  f ^= sign;
+
+  uint16_t h;
+  if (f >= 0x47800000u) {
+    // Too large for a half, or already Inf / NaN
+    h = f > 0x7f800000u ? 0x7e00 : 0x7c00;
+  } else if (f < 0x38800000u) {
+    // Denormal or zero.  Adding 0.5 aligns the half mantissa with the low
+    // bits of the float, so the FPU performs the rounding.
+    float t;
+    memcpy(&t, &f, sizeof(t));
+    t += 0.5f;
+    uint32_t u;
+    memcpy(&u, &t, sizeof(u));
+    h = (uint16_t)(u - 0x3f000000u);
+  } else {
+    // Normal; rebias the exponent and round the mantissa to nearest even
+    uint32_t mantissaOdd = (f >> 13) & 1;
+    f += 0xc8000fffu + mantissaOdd;
+    h = (uint16_t)(f >> 13);
+  }
+  return h | (uint16_t)(sign >> 16);
+}
+
+float HalfToFloat(uint16_t h)
+{
+  const uint32_t shiftedExponent = 0x7c00u << 13;
+  uint32_t u = ((uint32_t)h & 0x7fffu) << 13;
+  uint32_t exponent = u & shiftedExponent;
+  u += (127 - 15) << 23;
+
+  float f;
+  if (exponent == shiftedExponent) {
+    // Inf / NaN
+    u += (128 - 16) << 23;
+    memcpy(&f, &u, sizeof(f));
+  } else if (exponent == 0) {
+    // Zero / denormal; renormalize with the FPU
+    u += 1 << 23;
+    memcpy(&f, &u, sizeof(f));
+    f -= 6.10351562e-05f; // 2^-14
+  } else {
+    memcpy(&f, &u, sizeof(f));
+  }
+  return ((h & 0x8000) != 0) ? -f : f;
+}
+
+int16_t FloatToSnorm16(float v)
+{
+  // Written so that NaN clamps to -1, matching _mm_max_ps
+  v = v > -1.0f ? v : -1.0f;
+  v = v < 1.0f ? v : 1.0f;
+  return (int16_t)lrintf(v * 32767.0f);
+}
+
+float Snorm16ToFloat(int16_t v)
+{
+  float f = (float)v * (1.0f / 32767.0f);
+  return f > -1.0f ? f : -1.0f;
+}
+
 } // namespace hydra
@@ -0,0 +1,440 @@
+//
+//  sphere.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include <atomic>
+#include <string.h>
+
+#include "../include/hydra.h"
+#include "krhelpers.h"
+
+namespace hydra {
+
+namespace {
+
+const float SPHERE_EPSILON = 0.00001f; // Relative slack when testing points against a fitted sphere
+const size_t SPHERE_WORDS_PER_TASK = 64; // Grain, in mask words, of batch tests spread over a Scheduler
+
+size_t _popCount(uint32_t v)
+{
+  v = v - ((v >> 1) & 0x55555555);
+  v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
+  return (((v + (v >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+}
+
+bool _containsLoose(const Sphere& s, const Vector3& p)
+{
+  float r = s.radius * (1.0f + SPHERE_EPSILON) + SPHERE_EPSILON;
+  return (p - s.center).sqrMagnitude() <= r * r;
+}
+
+Sphere _sphereFrom2(const Vector3& a, const Vector3& b)
+{
+  return Sphere::Create((a + b) * 0.5f, (b - a).magnitude() * 0.5f);
+}
+
+Sphere _sphereFrom3(const Vector3& a, const Vector3& b, const Vector3& c)
+{
+  // Circumscribed sphere of the triangle, centered on its plane
+  Vector3 ab = b - a;
+  Vector3 ac = c - a;
+  Vector3 n = Vector3::Cross(ab, ac);
+  float denom = 2.0f * n.sqrMagnitude();
+  if (denom <= std::numeric_limits<float>::min()) {
+    // Collinear; the sphere on the farthest pair encloses the third point
+    Sphere s = _sphereFrom2(a, b);
+    Sphere s2 = _sphereFrom2(a, c);
+    Sphere s3 = _sphereFrom2(b, c);
+    if (s2.radius > s.radius) s = s2;
+    if (s3.radius > s.radius) s = s3;
+    return s;
+  }
+  Vector3 offset = (Vector3::Cross(n, ab) * ac.sqrMagnitude() + Vector3::Cross(ac, n) * ab.sqrMagnitude()) / denom;
+  return Sphere::Create(a + offset, offset.magnitude());
+}
+
+Sphere _sphereFrom4(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d)
+{
+  Vector3 u = b - a;
+  Vector3 v = c - a;
+  Vector3 w = d - a;
+  float denom = 2.0f * Vector3::Dot(u, Vector3::Cross(v, w));
+  if (fabs(denom) <= std::numeric_limits<float>::min()) {
+    // Coplanar; use the smallest face circumsphere that encloses all four
+    Sphere faces[4] = { _sphereFrom3(a, b, c), _sphereFrom3(a, b, d), _sphereFrom3(a, c, d), _sphereFrom3(b, c, d) };
+    const Vector3* opposite[4] = { &d, &c, &b, &a };
+    Sphere best = faces[0];
+    bool found = false;
+    for (int i = 0; i < 4; i++) {
+      if (_containsLoose(faces[i], *opposite[i]) && (!found || faces[i].radius < best.radius)) {
+        best = faces[i];
+        found = true;
+      } else if (!found && faces[i].radius > best.radius) {
+        best = faces[i];
+      }
+    }
+    return best;
+  }
+  Vector3 offset = (Vector3::Cross(v, w) * u.sqrMagnitude() + Vector3::Cross(w, u) * v.sqrMagnitude() + Vector3::Cross(u, v) * w.sqrMagnitude()) / denom;
+  return Sphere::Create(a + offset, offset.magnitude());
+}
+
+Sphere _sphereFromSupport(const Vector3* support, int supportCount)
+{
+  switch (supportCount) {
+  case 1:
+    return Sphere::Create(support[0], 0.0f);
+  case 2:
+    return _sphereFrom2(support[0], support[1]);
+  case 3:
+    return _sphereFrom3(support[0], support[1], support[2]);
+  case 4:
+    return _sphereFrom4(support[0], support[1], support[2], support[3]);
+  default:
+    return Sphere::Create(Vector3::Zero(), -1.0f);
+  }
+}
+
+Sphere _welzl(const Vector3* points, size_t count, Vector3* support, int supportCount)
+{
+  // Iterative over the points and recursive over the support set, so that
+  // the recursion depth is bounded by 4 rather than by the point count.
+  Sphere s = _sphereFromSupport(support, supportCount);
+  if (supportCount == 4) {
+    return s;
+  }
+  for (size_t i = 0; i < count; i++) {
+    if (s.radius < 0.0f || !_containsLoose(s, points[i])) {
+      support[supportCount] = points[i];
+      s = _welzl(points, i, support, supportCount + 1);
+    }
+  }
+  return s;
+}
+
+} // anonymous namespace
+
+void Sphere::init()
+{
+  center = Vector3::Zero();
+  radius = 0.0f;
+}
+
+Sphere Sphere::Create()
+{
+  Sphere r;
+  r.init();
+  return r;
+}
+
+void Sphere::init(const Vector3& sphereCenter, float sphereRadius)
+{
+  center = sphereCenter;
+  radius = sphereRadius;
+}
+
+Sphere Sphere::Create(const Vector3& sphereCenter, float sphereRadius)
+{
+  Sphere r;
+  r.init(sphereCenter, sphereRadius);
+  return r;
+}
+
+void Sphere::init(const AABB& box)
+{
+  center = box.center();
+  radius = box.size().magnitude() * 0.5f;
+}
+
+Sphere Sphere::Create(const AABB& box)
+{
+  Sphere r;
+  r.init(box);
+  return r;
+}
+
+AABB Sphere::bounds() const
+{
+  Vector3 extent = Vector3::Create(radius);
+  return AABB::Create(center - extent, center + extent);
+}
+
+float Sphere::volume() const
+{
+  return (4.0f / 3.0f) * PI * radius * radius * radius;
+}
+
+float Sphere::surfaceArea() const
+{
+  return 4.0f * PI * radius * radius;
+}
+
+bool Sphere::contains(const Vector3& p) const
+{
+  return (p - center).sqrMagnitude() <= radius * radius;
+}
+
+bool Sphere::contains(const Sphere& b) const
+{
+  float r = radius - b.radius;
+  return r >= 0.0f && (b.center - center).sqrMagnitude() <= r * r;
+}
+
+Vector3 Sphere::nearestPoint(const Vector3& p) const
+{
+  Vector3 d = p - center;
+  float dist2 = d.sqrMagnitude();
+  if (dist2 <= radius * radius) {
+    return p;
+  }
+  return center + d * (radius / sqrtf(dist2));
+}
+
+bool Sphere::intersects(const Sphere& b) const
+{
+  float r = radius + b.radius;
+  return (b.center - center).sqrMagnitude() <= r * r;
+}
+
+bool Sphere::intersects(const AABB& b) const
+{
+  return (b.nearestPoint(center) - center).sqrMagnitude() <= radius * radius;
+}
+
+bool Sphere::intersectsRay(const Vector3& start, const Vector3& dir) const
+{
+  float distance;
+  return intersectsRay(start, dir, distance);
+}
+
+bool Sphere::intersectsRay(const Vector3& start, const Vector3& dir, float& distance) const
+{
+  // From: Real-Time Collision Detection, Christer Ericson, 5.3.2
+  Vector3 m = start - center;
+  float c = m.sqrMagnitude() - radius * radius;
+  if (c <= 0.0f) {
+    distance = 0.0f; // Starts inside
+    return true;
+  }
+  float b = Vector3::Dot(m, dir);
+  if (b > 0.0f) {
+    return false; // Outside and pointing away
+  }
+  float a = dir.sqrMagnitude();
+  float discr = b * b - a * c;
+  if (discr < 0.0f || a == 0.0f) {
+    return false;
+  }
+  distance = (-b - sqrtf(discr)) / a;
+  return true;
+}
+
+bool Sphere::intersectsFrustum(const Plane* planes, int planeCount) const
+{
+  for (int i = 0; i < planeCount; i++) {
+    if (planes[i].distance(center) < -radius) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void Sphere::encapsulate(const Vector3& p)
+{
+  Vector3 d = p - center;
+  float dist2 = d.sqrMagnitude();
+  if (dist2 > radius * radius) {
+    float dist = sqrtf(dist2);
+    float newRadius = (radius + dist) * 0.5f;
+    center += d * ((newRadius - radius) / dist);
+    radius = newRadius;
+  }
+}
+
+void Sphere::encapsulate(const Sphere& b)
+{
+  *this = Merge(*this, b);
+}
+
+Sphere Sphere::Merge(const Sphere& a, const Sphere& b)
+{
+  Vector3 d = b.center - a.center;
+  float dist = d.magnitude();
+  if (dist + b.radius <= a.radius) {
+    return a;
+  }
+  if (dist + a.radius <= b.radius) {
+    return b;
+  }
+  float r = (dist + a.radius + b.radius) * 0.5f;
+  return Sphere::Create(a.center + d * ((r - a.radius) / dist), r);
+}
+
+bool Sphere::operator ==(const Sphere& b) const
+{
+  return center == b.center && radius == b.radius;
+}
+
+bool Sphere::operator !=(const Sphere& b) const
+{
+  return !(*this == b);
+}
+
+Sphere Sphere::FitRitter(const Vector3* points, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("Sphere::FitRitter");
+  // From: Real-Time Collision Detection, Christer Ericson, 4.3.2
+  if (count == 0) {
+    return Sphere::Create();
+  }
+
+  // Start with the most separated pair of the axis-extremal points
+  size_t minIndex[3] = { 0, 0, 0 };
+  size_t maxIndex[3] = { 0, 0, 0 };
+  for (size_t i = 1; i < count; i++) {
+    for (int axis = 0; axis < 3; axis++) {
+      if (points[i][axis] < points[minIndex[axis]][axis]) minIndex[axis] = i;
+      if (points[i][axis] > points[maxIndex[axis]][axis]) maxIndex[axis] = i;
+    }
+  }
+  int bestAxis = 0;
+  float bestDistance = -1.0f;
+  for (int axis = 0; axis < 3; axis++) {
+    float d = (points[maxIndex[axis]] - points[minIndex[axis]]).sqrMagnitude();
+    if (d > bestDistance) {
+      bestDistance = d;
+      bestAxis = axis;
+    }
+  }
+  Sphere s = _sphereFrom2(points[minIndex[bestAxis]], points[maxIndex[bestAxis]]);
+
+  for (size_t i = 0; i < count; i++) {
+    s.encapsulate(points[i]);
+  }
+  return s;
+}
+
+Sphere Sphere::FitWelzl(const Vector3* points, size_t count)
+{
+  Arena scratch;
+  return FitWelzl(points, count, scratch);
+}
+
+Sphere Sphere::FitWelzl(const Vector3* points, size_t count, Arena& scratch)
+{
+  HYDRA_PROFILE_SCOPE("Sphere::FitWelzl");
+  if (count == 0) {
+    return Sphere::Create();
+  }
+
+  // The expected linear running time depends on a random point order.  A
+  // fixed seed keeps the result deterministic.
+  Vector3* shuffled = scratch.allocate<Vector3>(count);
+  memcpy(shuffled, points, sizeof(Vector3) * count);
+  uint32_t seed = 0x9e3779b9;
+  for (size_t i = count - 1; i > 0; i--) {
+    seed = seed * 1664525 + 1013904223;
+    size_t j = (size_t)(seed >> 8) % (i + 1);
+    Vector3 t = shuffled[i];
+    shuffled[i] = shuffled[j];
+    shuffled[j] = t;
+  }
+
+  Vector3 support[4];
+  return _welzl(shuffled, count, support, 0);
+}
+
+size_t Sphere::BatchIntersects(const Sphere& query, const float* x, const float* y, const float* z, const float* radius, size_t count, uint32_t* mask)
+{
+  HYDRA_PROFILE_SCOPE("Sphere::BatchIntersects");
+  size_t hits = 0;
+  for (size_t base = 0; base < count; base += 32) {
+    size_t n = KRMIN(count - base, (size_t)32);
+    uint32_t bits = 0;
+    for (size_t i = 0; i < n; i++) {
+      float dx = x[base + i] - query.center.x;
+      float dy = y[base + i] - query.center.y;
+      float dz = z[base + i] - query.center.z;
+      float r = radius[base + i] + query.radius;
+      bits |= (uint32_t)(dx * dx + dy * dy + dz * dz <= r * r) << i;
+    }
+    mask[base / 32] = bits;
+    hits += _popCount(bits);
+  }
+  return hits;
+}
+
+size_t Sphere::BatchIntersectsFrustum(const Plane* planes, int planeCount, const float* x, const float* y, const float* z, const float* radius, size_t count, uint32_t* mask)
+{
+  HYDRA_PROFILE_SCOPE("Sphere::BatchIntersectsFrustum");
+  size_t hits = 0;
+  for (size_t base = 0; base < count; base += 32) {
+    size_t n = KRMIN(count - base, (size_t)32);
+    uint32_t bits = n == 32 ? 0xffffffff : (1u << n) - 1;
+    for (int p = 0; p < planeCount && bits != 0; p++) {
+      const Plane& plane = planes[p];
+      uint32_t planeBits = 0;
+      for (size_t i = 0; i < n; i++) {
+        float d = plane.normal.x * x[base + i] + plane.normal.y * y[base + i] + plane.normal.z * z[base + i] - plane.d;
+        planeBits |= (uint32_t)(d >= -radius[base + i]) << i;
+      }
+      bits &= planeBits;
+    }
+    mask[base / 32] = bits;
+    hits += _popCount(bits);
+  }
+  return hits;
+}
+
+size_t Sphere::BatchIntersects(const Sphere& query, const float* x, const float* y, const float* z, const float* radius, size_t count, uint32_t* mask, Scheduler& scheduler)
+{
+  HYDRA_PROFILE_SCOPE("Sphere::BatchIntersects(scheduler)");
+  std::atomic<size_t> hits(0);
+  scheduler.parallelFor(0, (count + 31) / 32, SPHERE_WORDS_PER_TASK, [&](size_t begin, size_t end) {
+    size_t base = begin * 32;
+    size_t n = KRMIN(end * 32, count) - base;
+    hits += BatchIntersects(query, x + base, y + base, z + base, radius + base, n, mask + begin);
+  });
+  return hits;
+}
+
+size_t Sphere::BatchIntersectsFrustum(const Plane* planes, int planeCount, const float* x, const float* y, const float* z, const float* radius, size_t count, uint32_t* mask, Scheduler& scheduler)
+{
+  HYDRA_PROFILE_SCOPE("Sphere::BatchIntersectsFrustum(scheduler)");
+  std::atomic<size_t> hits(0);
+  scheduler.parallelFor(0, (count + 31) / 32, SPHERE_WORDS_PER_TASK, [&](size_t begin, size_t end) {
+    size_t base = begin * 32;
+    size_t n = KRMIN(end * 32, count) - base;
+    hits += BatchIntersectsFrustum(planes, planeCount, x + base, y + base, z + base, radius + base, n, mask + begin);
+  });
+  return hits;
+}
+
+} // namespace hydra
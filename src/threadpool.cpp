@@ -0,0 +1,202 @@
+//
+//  threadpool.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+#include "assert.h"
+#include "krhelpers.h"
+
+namespace hydra {
+
+namespace {
+
+// The pool whose loop the current thread is running chunks of, if any
+thread_local const ThreadPool* _currentLoopPool = nullptr;
+
+uint64_t _packChunks(uint32_t first, uint32_t last)
+{
+  return ((uint64_t)last << 32) | first;
+}
+
+} // anonymous namespace
+
+Scheduler::~Scheduler()
+{
+
+}
+
+ThreadPool::ThreadPool(unsigned int threadCount)
+  : m_queues(threadCount > 0 ? threadCount : KRMAX(std::thread::hardware_concurrency(), 1u))
+  , m_generation(0)
+  , m_busyWorkers(0)
+  , m_exit(false)
+  , m_body(nullptr)
+  , m_begin(0)
+  , m_end(0)
+  , m_grain(1)
+{
+  for (unsigned int i = 1; i < m_queues.size(); i++) {
+    m_workers.push_back(std::thread(&ThreadPool::workerMain, this, i));
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_exit = true;
+  }
+  m_wake.notify_all();
+  for (size_t i = 0; i < m_workers.size(); i++) {
+    m_workers[i].join();
+  }
+}
+
+unsigned int ThreadPool::threadCount() const
+{
+  return (unsigned int)m_queues.size();
+}
+
+void ThreadPool::parallelFor(size_t begin, size_t end, size_t grain, const std::function<void(size_t, size_t)>& body)
+{
+  HYDRA_PROFILE_SCOPE("ThreadPool::parallelFor");
+  assert(grain > 0);
+  if (end <= begin) {
+    return;
+  }
+  size_t chunkCount = (end - begin - 1) / grain + 1;
+  if (chunkCount == 1 || m_workers.empty() || _currentLoopPool == this) {
+    for (size_t chunk = begin; chunk < end; chunk += KRMIN(grain, end - chunk)) {
+      body(chunk, chunk + KRMIN(grain, end - chunk));
+    }
+    return;
+  }
+  if (chunkCount > 0xffffffff) {
+    // Chunk indices are 32 bit; coarsen the chunks to fit
+    grain = (end - begin - 1) / 0xffffffff + 1;
+    chunkCount = (end - begin - 1) / grain + 1;
+  }
+
+  std::lock_guard<std::mutex> loopLock(m_loopMutex);
+
+  // Deal the chunks out evenly, in contiguous runs so that each thread
+  // touches neighbouring data
+  size_t queueCount = m_queues.size();
+  for (size_t i = 0; i < queueCount; i++) {
+    uint32_t first = (uint32_t)(chunkCount * i / queueCount);
+    uint32_t last = (uint32_t)(chunkCount * (i + 1) / queueCount);
+    m_queues[i].chunks = _packChunks(first, last);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_body = &body;
+    m_begin = begin;
+    m_end = end;
+    m_grain = grain;
+    m_busyWorkers = (unsigned int)m_workers.size();
+    m_generation++;
+  }
+  m_wake.notify_all();
+
+  const ThreadPool* outerPool = _currentLoopPool;
+  _currentLoopPool = this;
+  runChunks(0);
+  _currentLoopPool = outerPool;
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done.wait(lock, [this] { return m_busyWorkers == 0; });
+  m_body = nullptr;
+}
+
+void ThreadPool::workerMain(unsigned int index)
+{
+  _currentLoopPool = this;
+  uint64_t generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_wake.wait(lock, [this, generation] { return m_exit || m_generation != generation; });
+      if (m_exit) {
+        return;
+      }
+      generation = m_generation;
+    }
+
+    runChunks(index);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (--m_busyWorkers == 0) {
+      m_done.notify_one();
+    }
+  }
+}
+
+void ThreadPool::runChunks(unsigned int index)
+{
+  std::atomic<uint64_t>& queue = m_queues[index].chunks;
+  while (true) {
+    uint64_t chunks = queue.load();
+    uint32_t first = (uint32_t)chunks;
+    uint32_t last = (uint32_t)(chunks >> 32);
+    if (first < last) {
+      if (queue.compare_exchange_weak(chunks, _packChunks(first + 1, last))) {
+        size_t chunkBegin = m_begin + (size_t)first * m_grain;
+        (*m_body)(chunkBegin, chunkBegin + KRMIN(m_grain, m_end - chunkBegin));
+      }
+    } else if (!steal(index)) {
+      // Every queue is empty, so every chunk has been claimed
+      return;
+    }
+  }
+}
+
+bool ThreadPool::steal(unsigned int index)
+{
+  // The queue of this thread is empty, so no other thread modifies it until
+  // it is refilled here
+  size_t queueCount = m_queues.size();
+  for (size_t i = 1; i < queueCount; i++) {
+    std::atomic<uint64_t>& victim = m_queues[(index + i) % queueCount].chunks;
+    uint64_t chunks = victim.load();
+    while ((uint32_t)chunks < (uint32_t)(chunks >> 32)) {
+      uint32_t first = (uint32_t)chunks;
+      uint32_t last = (uint32_t)(chunks >> 32);
+      uint32_t mid = last - (last - first + 1) / 2;
+      if (victim.compare_exchange_weak(chunks, _packChunks(first, mid))) {
+        m_queues[index].chunks = _packChunks(mid, last);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+} // namespace hydra
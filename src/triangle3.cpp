@@ -30,6 +30,7 @@
 //
 
 #include "../include/hydra.h"
+#include "krhelpers.h"
 
 using namespace hydra;
 
@@ -74,26 +75,115 @@ bool _sameSide(const Vector3& p1, const Vector3& p2, const Vector3& a, const Vec
   return false;
 }
 
-Vector3 _closestPointOnLine(const Vector3& a, const Vector3& b, const Vector3& p)
+bool _axisSeparates(const Vector3& axis, const Vector3& v0, const Vector3& v1, const Vector3& v2, const Vector3& halfSize)
 {
-  // From: http://stackoverflow.com/questions/995445/determine-if-a-3d-point-is-within-a-triangle
+  // The triangle is translated so that the box is centered at the origin
+  float p0 = Vector3::Dot(axis, v0);
+  float p1 = Vector3::Dot(axis, v1);
+  float p2 = Vector3::Dot(axis, v2);
+  float r = halfSize.x * fabs(axis.x) + halfSize.y * fabs(axis.y) + halfSize.z * fabs(axis.z);
+  return KRMIN(p0, KRMIN(p1, p2)) > r || KRMAX(p0, KRMAX(p1, p2)) < -r;
+}
 
-  // Determine t (the length of the vector from ‘a’ to ‘p’)
+const float TRIANGLE_PLANE_EPSILON = 0.000001f; // Distances from a plane below this are treated as zero
 
-  Vector3 c = p - a;
-  Vector3 V = Vector3::Normalize(b - a);
-  float d = (a - b).magnitude();
-  float t = Vector3::Dot(V, c);
+float _orient2D(const Vector2& a, const Vector2& b, const Vector2& c)
+{
+  return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
 
-  // Check to see if ‘t’ is beyond the extents of the line segment
+bool _segmentsIntersect2D(const Vector2& a, const Vector2& b, const Vector2& c, const Vector2& d)
+{
+  float d1 = _orient2D(c, d, a);
+  float d2 = _orient2D(c, d, b);
+  float d3 = _orient2D(a, b, c);
+  float d4 = _orient2D(a, b, d);
+  if (((d1 > 0.0f && d2 < 0.0f) || (d1 < 0.0f && d2 > 0.0f)) && ((d3 > 0.0f && d4 < 0.0f) || (d3 < 0.0f && d4 > 0.0f))) {
+    return true;
+  }
+  // Collinear cases; an endpoint lying on the other segment
+  Vector2 segMin = Vector2::Min(c, d);
+  Vector2 segMax = Vector2::Max(c, d);
+  if (d1 == 0.0f && a.x >= segMin.x && a.x <= segMax.x && a.y >= segMin.y && a.y <= segMax.y) return true;
+  if (d2 == 0.0f && b.x >= segMin.x && b.x <= segMax.x && b.y >= segMin.y && b.y <= segMax.y) return true;
+  segMin = Vector2::Min(a, b);
+  segMax = Vector2::Max(a, b);
+  if (d3 == 0.0f && c.x >= segMin.x && c.x <= segMax.x && c.y >= segMin.y && c.y <= segMax.y) return true;
+  if (d4 == 0.0f && d.x >= segMin.x && d.x <= segMax.x && d.y >= segMin.y && d.y <= segMax.y) return true;
+  return false;
+}
 
-  if (t < 0) return a;
-  if (t > d) return b;
+bool _pointInTriangle2D(const Vector2& p, const Vector2* tri)
+{
+  float o1 = _orient2D(tri[0], tri[1], p);
+  float o2 = _orient2D(tri[1], tri[2], p);
+  float o3 = _orient2D(tri[2], tri[0], p);
+  return (o1 >= 0.0f && o2 >= 0.0f && o3 >= 0.0f) || (o1 <= 0.0f && o2 <= 0.0f && o3 <= 0.0f);
+}
 
-  // Return the point between ‘a’ and ‘b’
+bool _coplanarTrianglesIntersect(const Triangle3& a, const Triangle3& b, const Vector3& normal)
+{
+  // Project onto the coordinate plane most parallel to the triangles
+  int i0 = 1;
+  int i1 = 2;
+  if (fabs(normal.y) > fabs(normal.x) && fabs(normal.y) >= fabs(normal.z)) {
+    i0 = 0;
+  } else if (fabs(normal.z) > fabs(normal.x) && fabs(normal.z) > fabs(normal.y)) {
+    i1 = 0;
+  }
+  Vector2 pa[3];
+  Vector2 pb[3];
+  for (int i = 0; i < 3; i++) {
+    pa[i] = Vector2::Create(a[i][i0], a[i][i1]);
+    pb[i] = Vector2::Create(b[i][i0], b[i][i1]);
+  }
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      if (_segmentsIntersect2D(pa[i], pa[(i + 1) % 3], pb[j], pb[(j + 1) % 3])) {
+        return true;
+      }
+    }
+  }
+  // No edges cross, so either one triangle contains the other or they are disjoint
+  return _pointInTriangle2D(pa[0], pb) || _pointInTriangle2D(pb[0], pa);
+}
 
-  return a + V * t;
+bool _triangleInterval(const Triangle3& tri, const float* d, const Vector3& lineDir, Vector3& p0, Vector3& p1, float& t0, float& t1)
+{
+  // Finds the segment where the triangle crosses the other triangle's plane,
+  // given the signed distances d of its vertices from that plane.  Returns
+  // false when the triangle lies in the plane.
+  int alone;
+  if (d[0] * d[1] > 0.0f) {
+    alone = 2;
+  } else if (d[0] * d[2] > 0.0f) {
+    alone = 1;
+  } else if (d[1] * d[2] > 0.0f || d[0] != 0.0f) {
+    alone = 0;
+  } else if (d[1] != 0.0f) {
+    alone = 1;
+  } else if (d[2] != 0.0f) {
+    alone = 2;
+  } else {
+    return false;
+  }
+  int b = (alone + 1) % 3;
+  int c = (alone + 2) % 3;
+  p0 = tri[alone] + (tri[b] - tri[alone]) * (d[alone] / (d[alone] - d[b]));
+  p1 = tri[alone] + (tri[c] - tri[alone]) * (d[alone] / (d[alone] - d[c]));
+  t0 = Vector3::Dot(lineDir, p0);
+  t1 = Vector3::Dot(lineDir, p1);
+  if (t0 > t1) {
+    Vector3 tmpPoint = p0;
+    p0 = p1;
+    p1 = tmpPoint;
+    float tmp = t0;
+    t0 = t1;
+    t1 = tmp;
+  }
+  return true;
 }
+
 } // anonymous namespace
 
 namespace hydra {
@@ -149,6 +239,7 @@ Vector3 Triangle3::operator[](unsigned int i) const
 
 bool Triangle3::rayCast(const Vector3& start, const Vector3& dir, Vector3& hit_point) const
 {
+  HYDRA_PROFILE_SCOPE("Triangle3::rayCast");
   // algorithm based on Dan Sunday's implementation at http://geomalgorithms.com/a06-_intersect-2.html
   const float SMALL_NUM = 0.00000001f;     // anything that avoids division overflow
   Vector3   u, v, n;                    // triangle vectors
@@ -216,38 +307,128 @@ Vector3 Triangle3::calculateNormal() const
 
 Vector3 Triangle3::closestPointOnTriangle(const Vector3& p) const
 {
-  Vector3 a = vert[0];
-  Vector3 b = vert[1];
-  Vector3 c = vert[2];
-
-  Vector3 Rab = _closestPointOnLine(a, b, p);
-  Vector3 Rbc = _closestPointOnLine(b, c, p);
-  Vector3 Rca = _closestPointOnLine(c, a, p);
-
-  // return closest [Rab, Rbc, Rca] to p;
-  float sd_Rab = (p - Rab).sqrMagnitude();
-  float sd_Rbc = (p - Rbc).sqrMagnitude();
-  float sd_Rca = (p - Rca).sqrMagnitude();
-
-  if (sd_Rab < sd_Rbc && sd_Rab < sd_Rca) {
-    return Rab;
-  } else if (sd_Rbc < sd_Rab && sd_Rbc < sd_Rca) {
-    return Rbc;
-  } else {
-    return Rca;
+  Vector2 barycentric;
+  return closestPointOnTriangle(p, barycentric);
+}
+
+Vector3 Triangle3::closestPointOnTriangle(const Vector3& p, Vector2& barycentric) const
+{
+  HYDRA_PROFILE_SCOPE("Triangle3::closestPointOnTriangle");
+  // From: Real-Time Collision Detection, Christer Ericson, 5.1.5
+  // Determines which Voronoi region of the triangle contains p, then projects
+  // p onto that vertex, edge or face.  No square roots are required.
+
+  const Vector3& a = vert[0];
+  const Vector3& b = vert[1];
+  const Vector3& c = vert[2];
+
+  // Vertex region outside a
+  Vector3 ab = b - a;
+  Vector3 ac = c - a;
+  Vector3 ap = p - a;
+  float d1 = Vector3::Dot(ab, ap);
+  float d2 = Vector3::Dot(ac, ap);
+  if (d1 <= 0.0f && d2 <= 0.0f) {
+    barycentric = Vector2::Create(0.0f, 0.0f);
+    return a;
+  }
+
+  // Vertex region outside b
+  Vector3 bp = p - b;
+  float d3 = Vector3::Dot(ab, bp);
+  float d4 = Vector3::Dot(ac, bp);
+  if (d3 >= 0.0f && d4 <= d3) {
+    barycentric = Vector2::Create(1.0f, 0.0f);
+    return b;
+  }
+
+  // Edge region of ab
+  float vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+    float v = d1 / (d1 - d3);
+    barycentric = Vector2::Create(v, 0.0f);
+    return a + ab * v;
   }
+
+  // Vertex region outside c
+  Vector3 cp = p - c;
+  float d5 = Vector3::Dot(ab, cp);
+  float d6 = Vector3::Dot(ac, cp);
+  if (d6 >= 0.0f && d5 <= d6) {
+    barycentric = Vector2::Create(0.0f, 1.0f);
+    return c;
+  }
+
+  // Edge region of ac
+  float vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+    float w = d2 / (d2 - d6);
+    barycentric = Vector2::Create(0.0f, w);
+    return a + ac * w;
+  }
+
+  // Edge region of bc
+  float va = d3 * d6 - d5 * d4;
+  if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+    float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    barycentric = Vector2::Create(1.0f - w, w);
+    return b + (c - b) * w;
+  }
+
+  // Face region
+  float denom = va + vb + vc;
+  if (denom == 0.0f) {
+    // Degenerate triangle; every vertex and edge region test failed
+    barycentric = Vector2::Create(0.0f, 0.0f);
+    return a;
+  }
+  float inv_denom = 1.0f / denom;
+  float v = vb * inv_denom;
+  float w = vc * inv_denom;
+  barycentric = Vector2::Create(v, w);
+  return a + ab * v + ac * w;
+}
+
+size_t Triangle3::ClosestPointOnTriangles(const Triangle3* triangles, size_t count, const Vector3& p, Vector3& closest_point, Vector2& barycentric)
+{
+  HYDRA_PROFILE_SCOPE("Triangle3::ClosestPointOnTriangles");
+  size_t closest = count;
+  float closest_sqr_distance = std::numeric_limits<float>::max();
+  for (size_t i = 0; i < count; i++) {
+    const Triangle3& tri = triangles[i];
+
+    // The distance to the triangle's bounding box is a lower bound for the
+    // distance to the triangle, and is cheap enough to reject most candidates
+    Vector3 tri_min = Vector3::Min(Vector3::Min(tri.vert[0], tri.vert[1]), tri.vert[2]);
+    Vector3 tri_max = Vector3::Max(Vector3::Max(tri.vert[0], tri.vert[1]), tri.vert[2]);
+    Vector3 delta = Vector3::Max(Vector3::Max(tri_min - p, p - tri_max), Vector3::Zero());
+    if (delta.sqrMagnitude() >= closest_sqr_distance) {
+      continue;
+    }
+
+    Vector2 tri_barycentric;
+    Vector3 tri_point = tri.closestPointOnTriangle(p, tri_barycentric);
+    float sqr_distance = (tri_point - p).sqrMagnitude();
+    if (sqr_distance < closest_sqr_distance) {
+      closest_sqr_distance = sqr_distance;
+      closest = i;
+      closest_point = tri_point;
+      barycentric = tri_barycentric;
+    }
+  }
+  return closest;
 }
 
 bool Triangle3::sphereCast(const Vector3& start, const Vector3& dir, float radius, Vector3& hit_point, float& hit_distance) const
 {
+  HYDRA_PROFILE_SCOPE("Triangle3::sphereCast");
   // Dir must be normalized
   const float SMALL_NUM = 0.001f;     // anything that avoids division overflow
 
-  Vector3 tri_normal = calculateNormal();
+  Plane plane = Plane::Create(*this);
+  const Vector3& tri_normal = plane.normal;
 
-  float d = Vector3::Dot(tri_normal, vert[0]);
-  float e = Vector3::Dot(tri_normal, start) - radius;
-  float cotangent_distance = e - d;
+  float cotangent_distance = plane.distance(start) - radius;
 
   Vector3 plane_intersect;
   float plane_intersect_distance;
@@ -298,8 +479,120 @@ bool Triangle3::sphereCast(const Vector3& start, const Vector3& dir, float radiu
 }
 
 
+bool Triangle3::intersectsAABB(const AABB& box) const
+{
+  HYDRA_PROFILE_SCOPE("Triangle3::intersectsAABB");
+  // From: Fast 3D Triangle-Box Overlap Testing, Tomas Akenine-Moller
+  Vector3 center = box.center();
+  Vector3 halfSize = box.size() * 0.5f;
+  Vector3 v0 = vert[0] - center;
+  Vector3 v1 = vert[1] - center;
+  Vector3 v2 = vert[2] - center;
+
+  // The box's face normals; equivalent to testing the triangle's bounds
+  for (int axis = 0; axis < 3; axis++) {
+    if (KRMIN(v0[axis], KRMIN(v1[axis], v2[axis])) > halfSize[axis] || KRMAX(v0[axis], KRMAX(v1[axis], v2[axis])) < -halfSize[axis]) {
+      return false;
+    }
+  }
+
+  // The 9 cross products of the box axes with the triangle edges
+  Vector3 edges[3] = { v1 - v0, v2 - v1, v0 - v2 };
+  for (int i = 0; i < 3; i++) {
+    const Vector3& e = edges[i];
+    if (_axisSeparates(Vector3::Create(0.0f, -e.z, e.y), v0, v1, v2, halfSize)
+      || _axisSeparates(Vector3::Create(e.z, 0.0f, -e.x), v0, v1, v2, halfSize)
+      || _axisSeparates(Vector3::Create(-e.y, e.x, 0.0f), v0, v1, v2, halfSize)) {
+      return false;
+    }
+  }
+
+  // The triangle's plane
+  Vector3 normal = Vector3::Cross(edges[0], edges[1]);
+  float d = Vector3::Dot(normal, v0);
+  float r = halfSize.x * fabs(normal.x) + halfSize.y * fabs(normal.y) + halfSize.z * fabs(normal.z);
+  return fabs(d) <= r;
+}
+
+size_t Triangle3::IntersectsAABB(const Triangle3* triangles, size_t count, const AABB& box, uint32_t* mask)
+{
+  HYDRA_PROFILE_SCOPE("Triangle3::IntersectsAABB");
+  size_t hits = 0;
+  for (size_t base = 0; base < count; base += 32) {
+    size_t n = KRMIN(count - base, (size_t)32);
+    uint32_t bits = 0;
+    for (size_t i = 0; i < n; i++) {
+      if (triangles[base + i].intersectsAABB(box)) {
+        bits |= 1u << i;
+        hits++;
+      }
+    }
+    mask[base / 32] = bits;
+  }
+  return hits;
+}
+
+bool Triangle3::intersects(const Triangle3& b) const
+{
+  // Profiled by the overload it forwards to
+  Vector3 segmentStart;
+  Vector3 segmentEnd;
+  bool coplanar;
+  return intersects(b, segmentStart, segmentEnd, coplanar);
+}
+
+bool Triangle3::intersects(const Triangle3& b, Vector3& segmentStart, Vector3& segmentEnd, bool& coplanar) const
+{
+  HYDRA_PROFILE_SCOPE("Triangle3::intersects");
+  // From: A Fast Triangle-Triangle Intersection Test, Tomas Moller
+  coplanar = false;
+
+  // Reject if b lies entirely on one side of this triangle's plane
+  Plane planeA = Plane::Create(*this);
+  float db[3];
+  for (int i = 0; i < 3; i++) {
+    db[i] = planeA.distance(b[i]);
+    if (fabs(db[i]) < TRIANGLE_PLANE_EPSILON) {
+      db[i] = 0.0f;
+    }
+  }
+  if ((db[0] > 0.0f && db[1] > 0.0f && db[2] > 0.0f) || (db[0] < 0.0f && db[1] < 0.0f && db[2] < 0.0f)) {
+    return false;
+  }
+
+  // And the converse
+  Plane planeB = Plane::Create(b);
+  float da[3];
+  for (int i = 0; i < 3; i++) {
+    da[i] = planeB.distance(vert[i]);
+    if (fabs(da[i]) < TRIANGLE_PLANE_EPSILON) {
+      da[i] = 0.0f;
+    }
+  }
+  if ((da[0] > 0.0f && da[1] > 0.0f && da[2] > 0.0f) || (da[0] < 0.0f && da[1] < 0.0f && da[2] < 0.0f)) {
+    return false;
+  }
+
+  // Each triangle crosses the other's plane along a segment of the line where
+  // the planes meet; the triangles intersect where the segments overlap.
+  Vector3 lineDir = Vector3::Cross(planeA.normal, planeB.normal);
+  Vector3 a0, a1, b0, b1;
+  float ta0, ta1, tb0, tb1;
+  if (!_triangleInterval(*this, da, lineDir, a0, a1, ta0, ta1) || !_triangleInterval(b, db, lineDir, b0, b1, tb0, tb1)) {
+    coplanar = true;
+    return _coplanarTrianglesIntersect(*this, b, planeA.normal);
+  }
+  if (ta1 < tb0 || tb1 < ta0) {
+    return false;
+  }
+  segmentStart = ta0 > tb0 ? a0 : b0;
+  segmentEnd = ta1 < tb1 ? a1 : b1;
+  return true;
+}
+
 bool Triangle3::containsPoint(const Vector3& p) const
 {
+  HYDRA_PROFILE_SCOPE("Triangle3::containsPoint");
   /*
   // From: http://stackoverflow.com/questions/995445/determine-if-a-3d-point-is-within-a-triangle
 
@@ -40,39 +40,18 @@ void Vector2i::init()
   y = 0;
 }
 
-Vector2i Vector2i::Create()
-{
-  Vector2i r;
-  r.init();
-  return r;
-}
-
 void Vector2i::init(int X, int Y)
 {
   x = X;
   y = Y;
 }
 
-Vector2i Vector2i::Create(int X, int Y)
-{
-  Vector2i r;
-  r.init(X, Y);
-  return r;
-}
-
 void Vector2i::init(int v)
 {
   x = v;
   y = v;
 }
 
-Vector2i Vector2i::Create(int v)
-{
-  Vector2i r;
-  r.init(v);
-  return r;
-}
-
 void Vector2i::init(int* v)
 {
   x = v[0];
@@ -92,18 +71,7 @@ void Vector2i::init(const Vector2i& v)
   y = v.y;
 }
 
-Vector2i Vector2i::Create(const Vector2i& v)
-{
-  Vector2i r;
-  r.init(v);
-  return r;
-}
-
 // Vector2 swizzle getters
-Vector2i Vector2i::yx() const
-{
-  return Vector2i::Create(y, x);
-}
 
 // Vector2 swizzle setters
 void Vector2i::yx(const Vector2i& v)
@@ -112,56 +80,6 @@ void Vector2i::yx(const Vector2i& v)
   x = v.y;
 }
 
-Vector2i Vector2i::Min()
-{
-  return Vector2i::Create(-std::numeric_limits<int>::max());
-}
-
-Vector2i Vector2i::Max()
-{
-  return Vector2i::Create(std::numeric_limits<int>::max());
-}
-
-Vector2i Vector2i::Zero()
-{
-  return Vector2i::Create(0);
-}
-
-Vector2i Vector2i::One()
-{
-  return Vector2i::Create(1);
-}
-
-Vector2i Vector2i::operator +(const Vector2i& b) const
-{
-  return Vector2i::Create(x + b.x, y + b.y);
-}
-
-Vector2i Vector2i::operator -(const Vector2i& b) const
-{
-  return Vector2i::Create(x - b.x, y - b.y);
-}
-
-Vector2i Vector2i::operator +() const
-{
-  return *this;
-}
-
-Vector2i Vector2i::operator -() const
-{
-  return Vector2i::Create(-x, -y);
-}
-
-Vector2i Vector2i::operator *(const int v) const
-{
-  return Vector2i::Create(x * v, y * v);
-}
-
-Vector2i Vector2i::operator /(const int v) const
-{
-  return Vector2i::Create(x / v, y / v);
-}
-
 Vector2i& Vector2i::operator +=(const Vector2i& b)
 {
   x += b.x;
@@ -190,16 +108,6 @@ Vector2i& Vector2i::operator /=(const int v)
   return *this;
 }
 
-bool Vector2i::operator ==(const Vector2i& b) const
-{
-  return x == b.x && y == b.y;
-}
-
-bool Vector2i::operator !=(const Vector2i& b) const
-{
-  return x != b.x || y != b.y;
-}
-
 bool Vector2i::operator >(const Vector2i& b) const
 {
   // Comparison operators are implemented to allow insertion into sorted containers such as std::set
@@ -257,11 +165,6 @@ void Vector2i::normalize()
   y /= m;
 }
 
-int Vector2i::sqrMagnitude() const
-{
-  return x * x + y * y;
-}
-
 int Vector2i::magnitude() const
 {
   return static_cast<int>(sqrtf((float)x * (float)x + (float)y * (float)y));
@@ -273,24 +176,4 @@ Vector2i Vector2i::Normalize(const Vector2i& v)
   return Vector2i::Create(v.x / m, v.y / m);
 }
 
-int Vector2i::Cross(const Vector2i& v1, const Vector2i& v2)
-{
-  return v1.x * v2.y - v1.y * v2.x;
-}
-
-int Vector2i::Dot(const Vector2i& v1, const Vector2i& v2)
-{
-  return v1.x * v2.x + v1.y * v2.y;
-}
-
-Vector2i Vector2i::Min(const Vector2i& v1, const Vector2i& v2)
-{
-  return Vector2i::Create(KRMIN(v1.x, v2.x), KRMIN(v1.y, v2.y));
-}
-
-Vector2i Vector2i::Max(const Vector2i& v1, const Vector2i& v2)
-{
-  return Vector2i::Create(KRMAX(v1.x, v2.x), KRMAX(v1.y, v2.y));
-}
-
 } // namepsace hydra
@@ -42,13 +42,6 @@ void Vector3::init()
   z = 0.0f;
 }
 
-Vector3 Vector3::Create()
-{
-  Vector3 r;
-  r.init();
-  return r;
-}
-
 void Vector3::init(const Vector3& v)
 {
   x = v.x;
@@ -56,13 +49,6 @@ void Vector3::init(const Vector3& v)
   z = v.z;
 }
 
-Vector3 Vector3::Create(const Vector3& v)
-{
-  Vector3 r;
-  r.init(v);
-  return r;
-}
-
 void Vector3::init(const Vector4& v)
 {
   x = v.x;
@@ -70,13 +56,6 @@ void Vector3::init(const Vector4& v)
   z = v.z;
 }
 
-Vector3 Vector3::Create(const Vector4& v)
-{
-  Vector3 r;
-  r.init(v);
-  return r;
-}
-
 void Vector3::init(float* v)
 {
   x = v[0];
@@ -114,13 +93,6 @@ void Vector3::init(float v)
   z = v;
 }
 
-Vector3 Vector3::Create(float v)
-{
-  Vector3 r;
-  r.init(v);
-  return r;
-}
-
 void Vector3::init(float X, float Y, float Z)
 {
   x = X;
@@ -128,58 +100,6 @@ void Vector3::init(float X, float Y, float Z)
   z = Z;
 }
 
-Vector3 Vector3::Create(float X, float Y, float Z)
-{
-  Vector3 r;
-  r.init(X, Y, Z);
-  return r;
-}
-
-Vector2 Vector3::xx() const
-{
-  return Vector2::Create(x, x);
-}
-
-Vector2 Vector3::xy() const
-{
-  return Vector2::Create(x, y);
-}
-
-Vector2 Vector3::xz() const
-{
-  return Vector2::Create(x, z);
-}
-
-Vector2 Vector3::yx() const
-{
-  return Vector2::Create(y, x);
-}
-
-Vector2 Vector3::yy() const
-{
-  return Vector2::Create(y, y);
-}
-
-Vector2 Vector3::yz() const
-{
-  return Vector2::Create(y, z);
-}
-
-Vector2 Vector3::zx() const
-{
-  return Vector2::Create(z, x);
-}
-
-Vector2 Vector3::zy() const
-{
-  return Vector2::Create(z, y);
-}
-
-Vector2 Vector3::zz() const
-{
-  return Vector2::Create(z, z);
-}
-
 void Vector3::xy(const Vector2& v)
 {
   x = v.x;
@@ -216,57 +136,6 @@ void Vector3::zy(const Vector2& v)
   y = v.y;
 }
 
-Vector3 Vector3::Min()
-{
-  return Vector3::Create(-std::numeric_limits<float>::max());
-}
-
-Vector3 Vector3::Max()
-{
-  return Vector3::Create(std::numeric_limits<float>::max());
-}
-
-Vector3 Vector3::Zero()
-{
-  return Vector3::Create();
-}
-
-Vector3 Vector3::One()
-{
-  return Vector3::Create(1.0f, 1.0f, 1.0f);
-}
-
-Vector3 Vector3::Forward()
-{
-  return Vector3::Create(0.0f, 0.0f, 1.0f);
-}
-
-Vector3 Vector3::Backward()
-{
-  return Vector3::Create(0.0f, 0.0f, -1.0f);
-}
-
-Vector3 Vector3::Up()
-{
-  return Vector3::Create(0.0f, 1.0f, 0.0f);
-}
-
-Vector3 Vector3::Down()
-{
-  return Vector3::Create(0.0f, -1.0f, 0.0f);
-}
-
-Vector3 Vector3::Left()
-{
-  return Vector3::Create(-1.0f, 0.0f, 0.0f);
-}
-
-Vector3 Vector3::Right()
-{
-  return Vector3::Create(1.0f, 0.0f, 0.0f);
-}
-
-
 void Vector3::scale(const Vector3& v)
 {
   x *= v.x;
@@ -274,18 +143,9 @@ void Vector3::scale(const Vector3& v)
   z *= v.z;
 }
 
-Vector3 Vector3::Scale(const Vector3& v1, const Vector3& v2)
-{
-  return Vector3::Create(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z);
-}
-
-Vector3 Vector3::Lerp(const Vector3& v1, const Vector3& v2, float d)
-{
-  return v1 + (v2 - v1) * d;
-}
-
 Vector3 Vector3::Slerp(const Vector3& v1, const Vector3& v2, float d)
 {
+  HYDRA_PROFILE_SCOPE("Vector3::Slerp");
   // From: http://keithmaggio.wordpress.com/2011/02/15/math-magician-lerp-slerp-and-nlerp/
   // Dot product - the cosine of the angle between 2 vectors.
   float dot = Vector3::Dot(v1, v2);
@@ -304,6 +164,7 @@ Vector3 Vector3::Slerp(const Vector3& v1, const Vector3& v2, float d)
 
 void Vector3::OrthoNormalize(Vector3& normal, Vector3& tangent)
 {
+  HYDRA_PROFILE_SCOPE("Vector3::OrthoNormalize");
   // Gram-Schmidt Orthonormalization
   normal.normalize();
   Vector3 proj = normal * Dot(tangent, normal);
@@ -319,34 +180,6 @@ Vector3& Vector3::operator =(const Vector4& b)
   return *this;
 }
 
-Vector3 Vector3::operator +(const Vector3& b) const
-{
-  return Vector3::Create(x + b.x, y + b.y, z + b.z);
-}
-Vector3 Vector3::operator -(const Vector3& b) const
-{
-  return Vector3::Create(x - b.x, y - b.y, z - b.z);
-}
-Vector3 Vector3::operator +() const
-{
-  return *this;
-}
-Vector3 Vector3::operator -() const
-{
-  return Vector3::Create(-x, -y, -z);
-}
-
-Vector3 Vector3::operator *(const float v) const
-{
-  return Vector3::Create(x * v, y * v, z * v);
-}
-
-Vector3 Vector3::operator /(const float v) const
-{
-  float inv_v = 1.0f / v;
-  return Vector3::Create(x * inv_v, y * inv_v, z * inv_v);
-}
-
 Vector3& Vector3::operator +=(const Vector3& b)
 {
   x += b.x;
@@ -384,16 +217,6 @@ Vector3& Vector3::operator /=(const float v)
   return *this;
 }
 
-bool Vector3::operator ==(const Vector3& b) const
-{
-  return x == b.x && y == b.y && z == b.z;
-
-}
-bool Vector3::operator !=(const Vector3& b) const
-{
-  return x != b.x || y != b.y || z != b.z;
-}
-
 float& Vector3::operator[](unsigned i)
 {
   switch (i) {
@@ -420,12 +243,6 @@ float Vector3::operator[](unsigned i) const
   }
 }
 
-float Vector3::sqrMagnitude() const
-{
-  // calculate the square of the magnitude (useful for comparison of magnitudes without the cost of a sqrt() function)
-  return x * x + y * y + z * z;
-}
-
 float Vector3::magnitude() const
 {
   return sqrtf(x * x + y * y + z * z);
@@ -444,28 +261,6 @@ Vector3 Vector3::Normalize(const Vector3& v)
   return Vector3::Create(v.x * inv_magnitude, v.y * inv_magnitude, v.z * inv_magnitude);
 }
 
-Vector3 Vector3::Cross(const Vector3& v1, const Vector3& v2)
-{
-  return Vector3::Create(v1.y * v2.z - v1.z * v2.y,
-                         v1.z * v2.x - v1.x * v2.z,
-                         v1.x * v2.y - v1.y * v2.x);
-}
-
-float Vector3::Dot(const Vector3& v1, const Vector3& v2)
-{
-  return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
-}
-
-Vector3 Vector3::Min(const Vector3& v1, const Vector3& v2)
-{
-  return Vector3::Create(KRMIN(v1.x, v2.x), KRMIN(v1.y, v2.y), KRMIN(v1.z, v2.z));
-}
-
-Vector3 Vector3::Max(const Vector3& v1, const Vector3& v2)
-{
-  return Vector3::Create(KRMAX(v1.x, v2.x), KRMAX(v1.y, v2.y), KRMAX(v1.z, v2.z));
-}
-
 bool Vector3::operator >(const Vector3& b) const
 {
   // Comparison operators are implemented to allow insertion into sorted containers such as std::set
@@ -0,0 +1,210 @@
+//
+//  vector3d.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+
+namespace hydra {
+
+void Vector3d::init()
+{
+  x = 0.0;
+  y = 0.0;
+  z = 0.0;
+}
+
+void Vector3d::init(double X, double Y, double Z)
+{
+  x = X;
+  y = Y;
+  z = Z;
+}
+
+void Vector3d::init(double v)
+{
+  x = v;
+  y = v;
+  z = v;
+}
+
+void Vector3d::init(double* v)
+{
+  x = v[0];
+  y = v[1];
+  z = v[2];
+}
+
+void Vector3d::init(const Vector3d& v)
+{
+  x = v.x;
+  y = v.y;
+  z = v.z;
+}
+
+void Vector3d::init(const Vector3& v)
+{
+  x = v.x;
+  y = v.y;
+  z = v.z;
+}
+
+Vector3d Vector3d::Create(double* v)
+{
+  Vector3d r;
+  r.init(v);
+  return r;
+}
+
+Vector3d& Vector3d::operator +=(const Vector3d& b)
+{
+  x += b.x;
+  y += b.y;
+  z += b.z;
+
+  return *this;
+}
+
+Vector3d& Vector3d::operator -=(const Vector3d& b)
+{
+  x -= b.x;
+  y -= b.y;
+  z -= b.z;
+
+  return *this;
+}
+
+Vector3d& Vector3d::operator *=(const double v)
+{
+  x *= v;
+  y *= v;
+  z *= v;
+
+  return *this;
+}
+
+Vector3d& Vector3d::operator /=(const double v)
+{
+  double inv_v = 1.0 / v;
+  x *= inv_v;
+  y *= inv_v;
+  z *= inv_v;
+
+  return *this;
+}
+
+bool Vector3d::operator >(const Vector3d& b) const
+{
+  // Comparison operators are implemented to allow insertion into sorted containers such as std::set
+  if (x > b.x) {
+    return true;
+  } else if (x < b.x) {
+    return false;
+  } else if (y > b.y) {
+    return true;
+  } else if (y < b.y) {
+    return false;
+  } else if (z > b.z) {
+    return true;
+  } else {
+    return false;
+  }
+}
+
+bool Vector3d::operator <(const Vector3d& b) const
+{
+  // Comparison operators are implemented to allow insertion into sorted containers such as std::set
+  if (x < b.x) {
+    return true;
+  } else if (x > b.x) {
+    return false;
+  } else if (y < b.y) {
+    return true;
+  } else if (y > b.y) {
+    return false;
+  } else if (z < b.z) {
+    return true;
+  } else {
+    return false;
+  }
+}
+
+double& Vector3d::operator[](unsigned i)
+{
+  switch (i) {
+  case 0:
+    return x;
+  case 1:
+    return y;
+  default:
+  case 2:
+    return z;
+  }
+}
+
+double Vector3d::operator[](unsigned i) const
+{
+  switch (i) {
+  case 0:
+    return x;
+  case 1:
+    return y;
+  case 2:
+  default:
+    return z;
+  }
+}
+
+double Vector3d::magnitude() const
+{
+  return sqrt(x * x + y * y + z * z);
+}
+
+void Vector3d::scale(const Vector3d& v)
+{
+  x *= v.x;
+  y *= v.y;
+  z *= v.z;
+}
+
+void Vector3d::normalize()
+{
+  double inv_magnitude = 1.0 / sqrt(x * x + y * y + z * z);
+  x *= inv_magnitude;
+  y *= inv_magnitude;
+  z *= inv_magnitude;
+}
+
+Vector3d Vector3d::Normalize(const Vector3d& v)
+{
+  double inv_magnitude = 1.0 / sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+  return Vector3d::Create(v.x * inv_magnitude, v.y * inv_magnitude, v.z * inv_magnitude);
+}
+
+} // namespace hydra
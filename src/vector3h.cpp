@@ -0,0 +1,109 @@
+//
+//  vector3h.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+
+#ifdef __F16C__
+#include <immintrin.h>
+#endif
+
+namespace hydra {
+
+static_assert(sizeof(Vector3) == sizeof(float) * 3, "Vector3 must be tightly packed");
+static_assert(sizeof(Vector3h) == sizeof(uint16_t) * 3, "Vector3h must be tightly packed");
+
+void Vector3h::init(const Vector3& v)
+{
+  x = FloatToHalf(v.x);
+  y = FloatToHalf(v.y);
+  z = FloatToHalf(v.z);
+}
+
+Vector3h Vector3h::Create(const Vector3& v)
+{
+  Vector3h r;
+  r.init(v);
+  return r;
+}
+
+Vector3 Vector3h::asVector3() const
+{
+  return Vector3::Create(HalfToFloat(x), HalfToFloat(y), HalfToFloat(z));
+}
+
+bool Vector3h::operator ==(const Vector3h& b) const
+{
+  return x == b.x && y == b.y && z == b.z;
+}
+
+bool Vector3h::operator !=(const Vector3h& b) const
+{
+  return x != b.x || y != b.y || z != b.z;
+}
+
+void Vector3h::Pack(const Vector3* v, Vector3h* out, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("Vector3h::Pack");
+  // Components are converted independently, so both arrays are treated as
+  // flat runs of count * 3 scalars
+  const float* src = &v->x;
+  uint16_t* dst = &out->x;
+  size_t n = count * 3;
+  size_t i = 0;
+#ifdef __F16C__
+  for (; i + 4 <= n; i += 4) {
+    __m128i h = _mm_cvtps_ph(_mm_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storel_epi64((__m128i*)(dst + i), h);
+  }
+#endif
+  for (; i < n; i++) {
+    dst[i] = FloatToHalf(src[i]);
+  }
+}
+
+void Vector3h::Unpack(const Vector3h* v, Vector3* out, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("Vector3h::Unpack");
+  const uint16_t* src = &v->x;
+  float* dst = &out->x;
+  size_t n = count * 3;
+  size_t i = 0;
+#ifdef __F16C__
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_ps(dst + i, _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)(src + i))));
+  }
+#endif
+  for (; i < n; i++) {
+    dst[i] = HalfToFloat(src[i]);
+  }
+}
+
+} // namespace hydra
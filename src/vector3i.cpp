@@ -42,13 +42,6 @@ void Vector3i::init()
   z = 0;
 }
 
-Vector3i Vector3i::Create()
-{
-  Vector3i r;
-  r.init();
-  return r;
-}
-
 void Vector3i::init(const Vector3i& v)
 {
   x = v.x;
@@ -56,13 +49,6 @@ void Vector3i::init(const Vector3i& v)
   z = v.z;
 }
 
-Vector3i Vector3i::Create(const Vector3i& v)
-{
-  Vector3i r;
-  r.init(v);
-  return r;
-}
-
 void Vector3i::init(int* v)
 {
   x = v[0];
@@ -84,13 +70,6 @@ void Vector3i::init(int v)
   z = v;
 }
 
-Vector3i Vector3i::Create(int v)
-{
-  Vector3i r;
-  r.init(v);
-  return r;
-}
-
 void Vector3i::init(int X, int Y, int Z)
 {
   x = X;
@@ -98,58 +77,6 @@ void Vector3i::init(int X, int Y, int Z)
   z = Z;
 }
 
-Vector3i Vector3i::Create(int X, int Y, int Z)
-{
-  Vector3i r;
-  r.init(X, Y, Z);
-  return r;
-}
-
-Vector2i Vector3i::xx() const
-{
-  return Vector2i::Create(x, x);
-}
-
-Vector2i Vector3i::xy() const
-{
-  return Vector2i::Create(x, y);
-}
-
-Vector2i Vector3i::xz() const
-{
-  return Vector2i::Create(x, z);
-}
-
-Vector2i Vector3i::yx() const
-{
-  return Vector2i::Create(y, x);
-}
-
-Vector2i Vector3i::yy() const
-{
-  return Vector2i::Create(y, y);
-}
-
-Vector2i Vector3i::yz() const
-{
-  return Vector2i::Create(y, z);
-}
-
-Vector2i Vector3i::zx() const
-{
-  return Vector2i::Create(z, x);
-}
-
-Vector2i Vector3i::zy() const
-{
-  return Vector2i::Create(z, y);
-}
-
-Vector2i Vector3i::zz() const
-{
-  return Vector2i::Create(z, z);
-}
-
 void Vector3i::xy(const Vector2i& v)
 {
   x = v.x;
@@ -186,57 +113,6 @@ void Vector3i::zy(const Vector2i& v)
   y = v.y;
 }
 
-Vector3i Vector3i::Min()
-{
-  return Vector3i::Create(-std::numeric_limits<int>::max());
-}
-
-Vector3i Vector3i::Max()
-{
-  return Vector3i::Create(std::numeric_limits<int>::max());
-}
-
-Vector3i Vector3i::Zero()
-{
-  return Vector3i::Create();
-}
-
-Vector3i Vector3i::One()
-{
-  return Vector3i::Create(1,1,1);
-}
-
-Vector3i Vector3i::Forward()
-{
-  return Vector3i::Create(0, 0, 1);
-}
-
-Vector3i Vector3i::Backward()
-{
-  return Vector3i::Create(0, 0, -1);
-}
-
-Vector3i Vector3i::Up()
-{
-  return Vector3i::Create(0,1,0);
-}
-
-Vector3i Vector3i::Down()
-{
-  return Vector3i::Create(0, -1, 0);
-}
-
-Vector3i Vector3i::Left()
-{
-  return Vector3i::Create(-1, 0, 0);
-}
-
-Vector3i Vector3i::Right()
-{
-  return Vector3i::Create(1,0,0);
-}
-
-
 void Vector3i::scale(const Vector3i& v)
 {
   x *= v.x;
@@ -244,38 +120,6 @@ void Vector3i::scale(const Vector3i& v)
   z *= v.z;
 }
 
-Vector3i Vector3i::Scale(const Vector3i& v1, const Vector3i& v2)
-{
-  return Vector3i::Create(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z);
-}
-
-Vector3i Vector3i::operator +(const Vector3i& b) const
-{
-  return Vector3i::Create(x + b.x, y + b.y, z + b.z);
-}
-Vector3i Vector3i::operator -(const Vector3i& b) const
-{
-  return Vector3i::Create(x - b.x, y - b.y, z - b.z);
-}
-Vector3i Vector3i::operator +() const
-{
-  return *this;
-}
-Vector3i Vector3i::operator -() const
-{
-  return Vector3i::Create(-x, -y, -z);
-}
-
-Vector3i Vector3i::operator *(const int v) const
-{
-  return Vector3i::Create(x * v, y * v, z * v);
-}
-
-Vector3i Vector3i::operator /(const int v) const
-{
-  return Vector3i::Create(x / v, y / v, z / v);
-}
-
 Vector3i& Vector3i::operator +=(const Vector3i& b)
 {
   x += b.x;
@@ -312,16 +156,6 @@ Vector3i& Vector3i::operator /=(const int v)
   return *this;
 }
 
-bool Vector3i::operator ==(const Vector3i& b) const
-{
-  return x == b.x && y == b.y && z == b.z;
-
-}
-bool Vector3i::operator !=(const Vector3i& b) const
-{
-  return x != b.x || y != b.y || z != b.z;
-}
-
 int& Vector3i::operator[](unsigned i)
 {
   switch (i) {
@@ -348,39 +182,11 @@ int Vector3i::operator[](unsigned i) const
   }
 }
 
-int Vector3i::sqrMagnitude() const
-{
-  // calculate the square of the magnitude (useful for comparison of magnitudes without the cost of a sqrt() function)
-  return x * x + y * y + z * z;
-}
-
 int Vector3i::magnitude() const
 {
   return sqrt(sqrMagnitude());
 }
 
-Vector3i Vector3i::Cross(const Vector3i& v1, const Vector3i& v2)
-{
-  return Vector3i::Create(v1.y * v2.z - v1.z * v2.y,
-                          v1.z * v2.x - v1.x * v2.z,
-                          v1.x * v2.y - v1.y * v2.x);
-}
-
-int Vector3i::Dot(const Vector3i& v1, const Vector3i& v2)
-{
-  return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
-}
-
-Vector3i Vector3i::Min(const Vector3i& v1, const Vector3i& v2)
-{
-  return Vector3i::Create(KRMIN(v1.x, v2.x), KRMIN(v1.y, v2.y), KRMIN(v1.z, v2.z));
-}
-
-Vector3i Vector3i::Max(const Vector3i& v1, const Vector3i& v2)
-{
-  return Vector3i::Create(KRMAX(v1.x, v2.x), KRMAX(v1.y, v2.y), KRMAX(v1.z, v2.z));
-}
-
 bool Vector3i::operator >(const Vector3i& b) const
 {
   // Comparison operators are implemented to allow insertion into sorted containers such as std::set
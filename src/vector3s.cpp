@@ -0,0 +1,121 @@
+//
+//  vector3s.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace hydra {
+
+static_assert(sizeof(Vector3s) == sizeof(int16_t) * 3, "Vector3s must be tightly packed");
+
+void Vector3s::init(const Vector3& v)
+{
+  x = FloatToSnorm16(v.x);
+  y = FloatToSnorm16(v.y);
+  z = FloatToSnorm16(v.z);
+}
+
+Vector3s Vector3s::Create(const Vector3& v)
+{
+  Vector3s r;
+  r.init(v);
+  return r;
+}
+
+Vector3 Vector3s::asVector3() const
+{
+  return Vector3::Create(Snorm16ToFloat(x), Snorm16ToFloat(y), Snorm16ToFloat(z));
+}
+
+bool Vector3s::operator ==(const Vector3s& b) const
+{
+  return x == b.x && y == b.y && z == b.z;
+}
+
+bool Vector3s::operator !=(const Vector3s& b) const
+{
+  return x != b.x || y != b.y || z != b.z;
+}
+
+void Vector3s::Pack(const Vector3* v, Vector3s* out, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("Vector3s::Pack");
+  // Components are converted independently, so both arrays are treated as
+  // flat runs of count * 3 scalars
+  const float* src = &v->x;
+  int16_t* dst = &out->x;
+  size_t n = count * 3;
+  size_t i = 0;
+#ifdef __SSE2__
+  const __m128 lo = _mm_set1_ps(-1.0f);
+  const __m128 hi = _mm_set1_ps(1.0f);
+  const __m128 scale = _mm_set1_ps(32767.0f);
+  for (; i + 8 <= n; i += 8) {
+    __m128 a = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i), lo), hi);
+    __m128 b = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i + 4), lo), hi);
+    __m128i ia = _mm_cvtps_epi32(_mm_mul_ps(a, scale));
+    __m128i ib = _mm_cvtps_epi32(_mm_mul_ps(b, scale));
+    _mm_storeu_si128((__m128i*)(dst + i), _mm_packs_epi32(ia, ib));
+  }
+#endif
+  for (; i < n; i++) {
+    dst[i] = FloatToSnorm16(src[i]);
+  }
+}
+
+void Vector3s::Unpack(const Vector3s* v, Vector3* out, size_t count)
+{
+  HYDRA_PROFILE_SCOPE("Vector3s::Unpack");
+  const int16_t* src = &v->x;
+  float* dst = &out->x;
+  size_t n = count * 3;
+  size_t i = 0;
+#ifdef __SSE2__
+  const __m128 lo = _mm_set1_ps(-1.0f);
+  const __m128 scale = _mm_set1_ps(1.0f / 32767.0f);
+  for (; i + 8 <= n; i += 8) {
+    __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+    // Sign extend by placing each int16 in the high half and shifting down
+    __m128i a = _mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16);
+    __m128i b = _mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16);
+    _mm_storeu_ps(dst + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(a), scale), lo));
+    _mm_storeu_ps(dst + i + 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(b), scale), lo));
+  }
+#endif
+  for (; i < n; i++) {
+    dst[i] = Snorm16ToFloat(src[i]);
+  }
+}
+
+} // namespace hydra
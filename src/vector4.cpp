@@ -43,13 +43,6 @@ void Vector4::init()
   w = 0.0f;
 }
 
-Vector4 Vector4::Create()
-{
-  Vector4 r;
-  r.init();
-  return r;
-}
-
 void Vector4::init(const Vector4& v)
 {
   x = v.x;
@@ -58,13 +51,6 @@ void Vector4::init(const Vector4& v)
   w = v.w;
 }
 
-Vector4 Vector4::Create(const Vector4& v)
-{
-  Vector4 r;
-  r.init(v);
-  return r;
-}
-
 void Vector4::init(const Vector3& v, float W)
 {
   x = v.x;
@@ -103,13 +89,6 @@ void Vector4::init(float v)
   w = v;
 }
 
-Vector4 Vector4::Create(float v)
-{
-  Vector4 r;
-  r.init(v);
-  return r;
-}
-
 void Vector4::init(float X, float Y, float Z, float W)
 {
   x = X;
@@ -118,70 +97,9 @@ void Vector4::init(float X, float Y, float Z, float W)
   w = W;
 }
 
-Vector4 Vector4::Create(float X, float Y, float Z, float W)
-{
-  Vector4 r;
-  r.init(X, Y, Z, W);
-  return r;
-}
-
-Vector4 Vector4::Min()
-{
-  return Vector4::Create(-std::numeric_limits<float>::max());
-}
-
-Vector4 Vector4::Max()
-{
-  return Vector4::Create(std::numeric_limits<float>::max());
-}
-
-Vector4 Vector4::Zero()
-{
-  return Vector4::Create();
-}
-
-Vector4 Vector4::One()
-{
-  return Vector4::Create(1.0f, 1.0f, 1.0f, 1.0f);
-}
-
-Vector4 Vector4::Forward()
-{
-  return Vector4::Create(0.0f, 0.0f, 1.0f, 1.0f);
-}
-
-Vector4 Vector4::Backward()
-{
-  return Vector4::Create(0.0f, 0.0f, -1.0f, 1.0f);
-}
-
-Vector4 Vector4::Up()
-{
-  return Vector4::Create(0.0f, 1.0f, 0.0f, 1.0f);
-}
-
-Vector4 Vector4::Down()
-{
-  return Vector4::Create(0.0f, -1.0f, 0.0f, 1.0f);
-}
-
-Vector4 Vector4::Left()
-{
-  return Vector4::Create(-1.0f, 0.0f, 0.0f, 1.0f);
-}
-
-Vector4 Vector4::Right()
-{
-  return Vector4::Create(1.0f, 0.0f, 0.0f, 1.0f);
-}
-
-Vector4 Vector4::Lerp(const Vector4& v1, const Vector4& v2, float d)
-{
-  return v1 + (v2 - v1) * d;
-}
-
 Vector4 Vector4::Slerp(const Vector4& v1, const Vector4& v2, float d)
 {
+  HYDRA_PROFILE_SCOPE("Vector4::Slerp");
   // From: http://keithmaggio.wordpress.com/2011/02/15/math-magician-lerp-slerp-and-nlerp/
   // Dot product - the cosine of the angle between 2 vectors.
   float dot = Vector4::Dot(v1, v2);
@@ -200,6 +118,7 @@ Vector4 Vector4::Slerp(const Vector4& v1, const Vector4& v2, float d)
 
 void Vector4::OrthoNormalize(Vector4& normal, Vector4& tangent)
 {
+  HYDRA_PROFILE_SCOPE("Vector4::OrthoNormalize");
   // Gram-Schmidt Orthonormalization
   normal.normalize();
   Vector4 proj = normal * Dot(tangent, normal);
@@ -207,33 +126,6 @@ void Vector4::OrthoNormalize(Vector4& normal, Vector4& tangent)
   tangent.normalize();
 }
 
-Vector4 Vector4::operator +(const Vector4& b) const
-{
-  return Vector4::Create(x + b.x, y + b.y, z + b.z, w + b.w);
-}
-Vector4 Vector4::operator -(const Vector4& b) const
-{
-  return Vector4::Create(x - b.x, y - b.y, z - b.z, w - b.w);
-}
-Vector4 Vector4::operator +() const
-{
-  return *this;
-}
-Vector4 Vector4::operator -() const
-{
-  return Vector4::Create(-x, -y, -z, -w);
-}
-
-Vector4 Vector4::operator *(const float v) const
-{
-  return Vector4::Create(x * v, y * v, z * v, w * v);
-}
-
-Vector4 Vector4::operator /(const float v) const
-{
-  return Vector4::Create(x / v, y / v, z / v, w / v);
-}
-
 Vector4& Vector4::operator +=(const Vector4& b)
 {
   x += b.x;
@@ -275,16 +167,6 @@ Vector4& Vector4::operator /=(const float v)
   return *this;
 }
 
-bool Vector4::operator ==(const Vector4& b) const
-{
-  return x == b.x && y == b.y && z == b.z && w == b.w;
-
-}
-bool Vector4::operator !=(const Vector4& b) const
-{
-  return x != b.x || y != b.y || z != b.z || w != b.w;
-}
-
 float& Vector4::operator[](unsigned i)
 {
   switch (i) {
@@ -315,12 +197,6 @@ float Vector4::operator[](unsigned i) const
   }
 }
 
-float Vector4::sqrMagnitude() const
-{
-  // calculate the square of the magnitude (useful for comparison of magnitudes without the cost of a sqrt() function)
-  return x * x + y * y + z * z + w * w;
-}
-
 float Vector4::magnitude() const
 {
   return sqrtf(x * x + y * y + z * z + w * w);
@@ -344,21 +220,6 @@ Vector4 Vector4::Normalize(const Vector4& v)
 }
 
 
-float Vector4::Dot(const Vector4& v1, const Vector4& v2)
-{
-  return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z + v1.w * v2.w;
-}
-
-Vector4 Vector4::Min(const Vector4& v1, const Vector4& v2)
-{
-  return Vector4::Create(KRMIN(v1.x, v2.x), KRMIN(v1.y, v2.y), KRMIN(v1.z, v2.z), KRMIN(v1.w, v2.w));
-}
-
-Vector4 Vector4::Max(const Vector4& v1, const Vector4& v2)
-{
-  return Vector4::Create(KRMAX(v1.x, v2.x), KRMAX(v1.y, v2.y), KRMAX(v1.z, v2.z), KRMAX(v1.w, v2.w));
-}
-
 bool Vector4::operator >(const Vector4& b) const
 {
   // Comparison operators are implemented to allow insertion into sorted containers such as std::set
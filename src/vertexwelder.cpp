@@ -0,0 +1,174 @@
+//
+//  vertexwelder.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+#include "krhelpers.h"
+
+#include <string.h>
+
+namespace hydra {
+
+namespace {
+
+const uint32_t WELD_EMPTY = 0xffffffff;
+
+struct WeldCell
+{
+  int key[3];
+  uint32_t head; // First welded vertex in the cell, or WELD_EMPTY for an unused slot
+};
+
+uint32_t* _findCell(WeldCell* table, size_t tableSize, const int* key, bool insert)
+{
+  // Linear probing; the table is kept at most half full
+  size_t mask = tableSize - 1;
+  for (size_t slot = (size_t)Hash::Ints(key, 3, 0) & mask;; slot = (slot + 1) & mask) {
+    WeldCell& cell = table[slot];
+    if (cell.head == WELD_EMPTY) {
+      if (!insert) {
+        return nullptr;
+      }
+      cell.key[0] = key[0];
+      cell.key[1] = key[1];
+      cell.key[2] = key[2];
+      return &cell.head;
+    }
+    if (cell.key[0] == key[0] && cell.key[1] == key[1] && cell.key[2] == key[2]) {
+      return &cell.head;
+    }
+  }
+}
+
+int _cellCoordinate(float v, float inv_cellSize)
+{
+  // Clamped so that distant coordinates cannot overflow the cast
+  float cell = floorf(v * inv_cellSize);
+  return (int)KRCLAMP(cell, -2147483520.0f, 2147483520.0f);
+}
+
+int _exactKey(float v)
+{
+  v += 0.0f; // -0.0 becomes 0.0
+  int key;
+  memcpy(&key, &v, sizeof(key));
+  return key;
+}
+
+} // anonymous namespace
+
+size_t VertexWelder::Weld(const Vector3* vertices, size_t count, float epsilon, std::vector<Vector3>& weldedVertices, std::vector<uint32_t>& remap)
+{
+  Arena scratch;
+  return Weld(vertices, count, epsilon, weldedVertices, remap, scratch);
+}
+
+size_t VertexWelder::Weld(const Vector3* vertices, size_t count, float epsilon, std::vector<Vector3>& weldedVertices, std::vector<uint32_t>& remap, Arena& scratch)
+{
+  HYDRA_PROFILE_SCOPE("VertexWelder::Weld");
+  weldedVertices.clear();
+  remap.resize(count);
+  if (count == 0) {
+    return 0;
+  }
+
+  size_t tableSize = 16;
+  while (tableSize < count * 2) {
+    tableSize *= 2;
+  }
+  WeldCell* table = scratch.allocate<WeldCell>(tableSize);
+  for (size_t i = 0; i < tableSize; i++) {
+    table[i].key[0] = table[i].key[1] = table[i].key[2] = 0;
+    table[i].head = WELD_EMPTY;
+  }
+  // Links the welded vertices sharing a cell, indexed like weldedVertices
+  uint32_t* next = scratch.allocate<uint32_t>(count);
+  weldedVertices.reserve(count);
+
+  bool exact = !(epsilon > 0.0f);
+  float sqrEpsilon = exact ? 0.0f : epsilon * epsilon;
+  float inv_cellSize = exact ? 0.0f : 0.5f / epsilon;
+
+  for (size_t i = 0; i < count; i++) {
+    const Vector3& v = vertices[i];
+    if (!std::isfinite(v.x) || !std::isfinite(v.y) || !std::isfinite(v.z)) {
+      remap[i] = (uint32_t)weldedVertices.size();
+      weldedVertices.push_back(v);
+      next[remap[i]] = WELD_EMPTY;
+      continue;
+    }
+
+    int key[3];
+    int probe[3]; // Direction of the neighboring cell nearest to v on each axis
+    for (int axis = 0; axis < 3; axis++) {
+      if (exact) {
+        key[axis] = _exactKey(v[axis]);
+        probe[axis] = 0;
+      } else {
+        float scaled = v[axis] * inv_cellSize;
+        key[axis] = _cellCoordinate(v[axis], inv_cellSize);
+        probe[axis] = scaled - floorf(scaled) < 0.5f ? -1 : 1;
+      }
+    }
+
+    // Any vertex within epsilon lies in the cell containing v or in one of
+    // the 7 neighbors on the near side of each axis.  The earliest match wins,
+    // so that the result does not depend on the probe order.
+    uint32_t match = WELD_EMPTY;
+    int probeCount = exact ? 1 : 8;
+    for (int p = 0; p < probeCount; p++) {
+      int neighbor[3];
+      for (int axis = 0; axis < 3; axis++) {
+        neighbor[axis] = key[axis] + ((p >> axis) & 1) * probe[axis];
+      }
+      uint32_t* head = _findCell(table, tableSize, neighbor, false);
+      if (head == nullptr) {
+        continue;
+      }
+      for (uint32_t w = *head; w != WELD_EMPTY; w = next[w]) {
+        if (w < match && (weldedVertices[w] - v).sqrMagnitude() <= sqrEpsilon) {
+          match = w;
+        }
+      }
+    }
+
+    if (match == WELD_EMPTY) {
+      match = (uint32_t)weldedVertices.size();
+      weldedVertices.push_back(v);
+      uint32_t* head = _findCell(table, tableSize, key, true);
+      next[match] = *head;
+      *head = match;
+    }
+    remap[i] = match;
+  }
+  return weldedVertices.size();
+}
+
+} // namespace hydra
@@ -0,0 +1,189 @@
+//
+//  voxelizer.cpp
+//  Kraken Engine / Hydra
+//
+//  Copyright 2024 Kearwood Gilbert. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without modification, are
+//  permitted provided that the following conditions are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//  conditions and the following disclaimer.
+//
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//  of conditions and the following disclaimer in the documentation and/or other materials
+//  provided with the distribution.
+//
+//  THIS SOFTWARE IS PROVIDED BY KEARWOOD GILBERT ''AS IS'' AND ANY EXPRESS OR IMPLIED
+//  WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+//  FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL KEARWOOD GILBERT OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+//  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+//  ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+//  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//  The views and conclusions contained in the software and documentation are those of the
+//  authors and should not be interpreted as representing official policies, either expressed
+//  or implied, of Kearwood Gilbert.
+//
+
+#include "../include/hydra.h"
+#include "assert.h"
+#include "krhelpers.h"
+
+#include <algorithm>
+
+namespace hydra {
+
+namespace {
+
+struct VoxelizeJob
+{
+  const Triangle3* triangles;
+  const Vector3i* cellMin; // Per triangle, the range of cells its bounds cover
+  const Vector3i* cellMax;
+  const uint32_t* sliceStart; // Triangles overlapping slice z are sliceTriangles[sliceStart[z]..sliceStart[z + 1]]
+  const uint32_t* sliceTriangles;
+  AABB bounds;
+  Vector3 cellSize;
+  Vector3i resolution;
+  std::vector<Vector3i>* sliceCells;
+};
+
+void _voxelizeSlices(const VoxelizeJob* job, int begin, int end)
+{
+  Vector3i resolution = job->resolution;
+  std::vector<uint8_t> occupied((size_t)resolution.x * resolution.y);
+  for (int z = begin; z < end; z++) {
+    uint32_t first = job->sliceStart[z];
+    uint32_t last = job->sliceStart[z + 1];
+    if (first == last) {
+      continue;
+    }
+    std::fill(occupied.begin(), occupied.end(), 0);
+    for (uint32_t i = first; i < last; i++) {
+      uint32_t t = job->sliceTriangles[i];
+      const Vector3i& cellMin = job->cellMin[t];
+      const Vector3i& cellMax = job->cellMax[t];
+      for (int y = cellMin.y; y <= cellMax.y; y++) {
+        for (int x = cellMin.x; x <= cellMax.x; x++) {
+          uint8_t& cell = occupied[(size_t)y * resolution.x + x];
+          if (cell) {
+            continue;
+          }
+          Vector3 cellCorner = job->bounds.min + Vector3::Create(x * job->cellSize.x, y * job->cellSize.y, z * job->cellSize.z);
+          if (job->triangles[t].intersectsAABB(AABB::Create(cellCorner, cellCorner + job->cellSize))) {
+            cell = 1;
+          }
+        }
+      }
+    }
+
+    std::vector<Vector3i>& cells = job->sliceCells[z];
+    for (int y = 0; y < resolution.y; y++) {
+      for (int x = 0; x < resolution.x; x++) {
+        if (occupied[(size_t)y * resolution.x + x]) {
+          cells.push_back(Vector3i::Create(x, y, z));
+        }
+      }
+    }
+  }
+}
+
+} // anonymous namespace
+
+void Voxelizer::Voxelize(const Triangle3* triangles, size_t count, const AABB& bounds, const Vector3i& resolution, unsigned int threadCount, std::vector<Vector3i>& cells)
+{
+  Arena scratch;
+  Voxelize(triangles, count, bounds, resolution, threadCount, cells, scratch);
+}
+
+void Voxelizer::Voxelize(const Triangle3* triangles, size_t count, const AABB& bounds, const Vector3i& resolution, Scheduler& scheduler, std::vector<Vector3i>& cells)
+{
+  Arena scratch;
+  Voxelize(triangles, count, bounds, resolution, scheduler, cells, scratch);
+}
+
+void Voxelizer::Voxelize(const Triangle3* triangles, size_t count, const AABB& bounds, const Vector3i& resolution, unsigned int threadCount, std::vector<Vector3i>& cells, Arena& scratch)
+{
+  if (threadCount == 0) {
+    threadCount = KRMAX(std::thread::hardware_concurrency(), 1u);
+  }
+  ThreadPool pool(KRMIN(threadCount, (unsigned int)KRMAX(resolution.z, 1)));
+  Voxelize(triangles, count, bounds, resolution, pool, cells, scratch);
+}
+
+void Voxelizer::Voxelize(const Triangle3* triangles, size_t count, const AABB& bounds, const Vector3i& resolution, Scheduler& scheduler, std::vector<Vector3i>& cells, Arena& scratch)
+{
+  HYDRA_PROFILE_SCOPE("Voxelizer::Voxelize");
+  assert(resolution.x > 0 && resolution.y > 0 && resolution.z > 0);
+  Vector3 size = bounds.size();
+  Vector3 cellSize = Vector3::Create(size.x / resolution.x, size.y / resolution.y, size.z / resolution.z);
+
+  // Find the cell range of each triangle's bounds and bucket the triangles
+  // by z slice, so that each slice can be voxelized independently
+  Vector3i* cellMin = scratch.allocate<Vector3i>(count);
+  Vector3i* cellMax = scratch.allocate<Vector3i>(count);
+  uint32_t* sliceStart = scratch.allocate<uint32_t>(resolution.z + 1);
+  std::fill(sliceStart, sliceStart + resolution.z + 1, 0);
+  for (size_t t = 0; t < count; t++) {
+    const Triangle3& tri = triangles[t];
+    Vector3 triMin = Vector3::Min(tri[0], Vector3::Min(tri[1], tri[2]));
+    Vector3 triMax = Vector3::Max(tri[0], Vector3::Max(tri[1], tri[2]));
+    bool outside = false;
+    for (int axis = 0; axis < 3; axis++) {
+      if (triMax[axis] < bounds.min[axis] || triMin[axis] > bounds.max[axis]) {
+        outside = true;
+      }
+      // A triangle starting exactly on a cell boundary also touches the cell below
+      float lo = ceilf((triMin[axis] - bounds.min[axis]) / cellSize[axis]) - 1.0f;
+      float hi = floorf((triMax[axis] - bounds.min[axis]) / cellSize[axis]);
+      cellMin[t][axis] = (int)KRCLAMP(lo, 0.0f, (float)(resolution[axis] - 1));
+      cellMax[t][axis] = (int)KRCLAMP(hi, 0.0f, (float)(resolution[axis] - 1));
+    }
+    if (outside) {
+      cellMin[t].z = 1;
+      cellMax[t].z = 0; // Empty range
+      continue;
+    }
+    for (int z = cellMin[t].z; z <= cellMax[t].z; z++) {
+      sliceStart[z + 1]++;
+    }
+  }
+  for (int z = 0; z < resolution.z; z++) {
+    sliceStart[z + 1] += sliceStart[z];
+  }
+  uint32_t* sliceTriangles = scratch.allocate<uint32_t>(sliceStart[resolution.z]);
+  uint32_t* sliceFill = scratch.allocate<uint32_t>(resolution.z);
+  std::copy(sliceStart, sliceStart + resolution.z, sliceFill);
+  for (size_t t = 0; t < count; t++) {
+    for (int z = cellMin[t].z; z <= cellMax[t].z; z++) {
+      sliceTriangles[sliceFill[z]++] = (uint32_t)t;
+    }
+  }
+
+  // The workers collect cells on the heap, as an Arena is not thread safe
+  std::vector<std::vector<Vector3i> > sliceCells(resolution.z);
+  VoxelizeJob job;
+  job.triangles = triangles;
+  job.cellMin = cellMin;
+  job.cellMax = cellMax;
+  job.sliceStart = sliceStart;
+  job.sliceTriangles = sliceTriangles;
+  job.bounds = bounds;
+  job.cellSize = cellSize;
+  job.resolution = resolution;
+  job.sliceCells = &sliceCells[0];
+
+  scheduler.parallelFor(0, resolution.z, 1, [&job](size_t begin, size_t end) {
+    _voxelizeSlices(&job, (int)begin, (int)end);
+  });
+
+  for (int z = 0; z < resolution.z; z++) {
+    cells.insert(cells.end(), sliceCells[z].begin(), sliceCells[z].end());
+  }
+}
+
+} // namespace hydra